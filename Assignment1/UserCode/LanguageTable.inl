@@ -0,0 +1,1578 @@
+// Generated by EmitLanguageTable, do not edit. Regenerate it whenever
+// CreateLanguageDfa or the driver token lists change.
+
+static const uint32_t LANGUAGE_TABLE_TOKEN_HASH = 0x8f2bcef0;
+static const uint16_t LANGUAGE_TABLE_ROOT = 1;
+static const uint16_t LANGUAGE_TABLE_ROWS = 191;
+static const uint16_t LANGUAGE_TABLE_CLASSES = 53;
+
+static const uint8_t s_languageClassMap[256] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 3, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 4, 5, 1, 1, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 19, 20, 21, 22, 1,
+    1, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 25, 26, 1, 23,
+    1, 27, 28, 29, 30, 31, 32, 33, 34, 35, 23, 36, 37, 38, 39, 40,
+    41, 23, 42, 43, 44, 45, 46, 47, 23, 48, 49, 50, 51, 52, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+static const uint16_t s_languageNext[LANGUAGE_TABLE_ROWS * LANGUAGE_TABLE_CLASSES] = {
+    // row 0
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 1
+    0x0000, 0x0000, 0xc01a, 0xc01a, 0x8012, 0x4018, 0x8010, 0x8011, 0x4019, 0x8002, 0x8003, 0x800e,
+    0x800c, 0x800a, 0x800d, 0x800b, 0x800f, 0x8017, 0x8009, 0x8008, 0x8014, 0x8013, 0x8015, 0x802b,
+    0x8004, 0x0000, 0x8005, 0x8026, 0x8023, 0x801b, 0x8021, 0x801f, 0x801d, 0x8024, 0x802b, 0x801e,
+    0x802b, 0x8025, 0x802b, 0x8028, 0x802b, 0x802a, 0x8022, 0x8029, 0x8027, 0x802b, 0x801c, 0x8020,
+    0x802b, 0x802b, 0x8006, 0x8016, 0x8007,
+    // row 2
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 3
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 4
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 5
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 6
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 7
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 8
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 9
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 10
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 11
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 12
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x802c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 13
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x802f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8030, 0x802e, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 14
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8031, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 15
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4033,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4034, 0x0000, 0x0000, 0x0000, 0x0000, 0x8032, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 16
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8035, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 17
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8036, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 18
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8037, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 19
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8038, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 20
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x803a, 0x8039, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 21
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x803b, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 22
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 23
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x003c, 0x0000, 0x8017, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 24
+    0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x803d, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018,
+    0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018,
+    0x4018, 0x003e, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018,
+    0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018, 0x4018,
+    0x4018, 0x4018, 0x4018, 0x4018, 0x4018,
+    // row 25
+    0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x803f, 0x4019, 0x4019, 0x4019,
+    0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019,
+    0x4019, 0x0040, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019,
+    0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019, 0x4019,
+    0x4019, 0x4019, 0x4019, 0x4019, 0x4019,
+    // row 26
+    0x0000, 0x0000, 0xc01a, 0xc01a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 27
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8043, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8041, 0x802b, 0x802b, 0x8042, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 28
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8044, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 29
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8047, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x8046, 0x802b, 0x802b, 0x802b, 0x802b, 0x8045, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 30
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8048, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x8049, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 31
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x804a, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 32
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x804b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 33
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x804d, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x804c, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 34
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x804e, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 35
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x804f, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 36
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x8050, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 37
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8051, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x8052, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 38
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8053, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 39
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8054, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x8055, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 40
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8057, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8056, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 41
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8058,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8059, 0x802b, 0x802b, 0x805a,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 42
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x805b, 0x802b, 0x802b, 0x805c, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 43
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 44
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 45
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 46
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 47
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 48
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 49
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 50
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 51
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x005d,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    // row 52
+    0x805e, 0x4034, 0x4034, 0x805e, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034,
+    0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034,
+    0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034,
+    0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034, 0x4034,
+    0x4034, 0x4034, 0x4034, 0x4034, 0x4034,
+    // row 53
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 54
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 55
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 56
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 57
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 58
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x805f, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 59
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 60
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 61
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 62
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4018, 0x0000, 0x0000, 0x4018, 0x0000, 0x4018, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 63
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 64
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4019, 0x0000, 0x0000, 0x4019, 0x0000, 0x4019, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 65
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8061, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 66
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x8062, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 67
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8063, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 68
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8064, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 69
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x8065, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 70
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8066, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 71
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8067, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 72
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 73
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8068, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 74
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8069, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 75
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x806a,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 76
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 77
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x806c, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x806b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 78
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x806e, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x806d, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 79
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x806f, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 80
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8070, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 81
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x8071, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 82
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x8072, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 83
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 84
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8073, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 85
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8074, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 86
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8075, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 87
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8076,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 88
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8077, 0x0000, 0x0000, 0x0000,
+    // row 89
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8079, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8078, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 90
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x807a,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 91
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x807b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 92
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x807c, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 93
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x807d, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    0x4033, 0x4033, 0x4033, 0x4033, 0x4033,
+    // row 94
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 95
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 96
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8060, 0x0000, 0x8060, 0x0000, 0x0000, 0x8060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8060, 0x807e, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 97
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x807f, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 98
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8081, 0x8080, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 99
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8082, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 100
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 101
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x8083, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 102
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 103
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8084, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 104
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x8085, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 105
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8086, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 106
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8087, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 107
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8088, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 108
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x8089, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 109
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x808a, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 110
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 111
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x808b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 112
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x808c, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 113
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x808d, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 114
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x808e, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 115
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x808f, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 116
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8090, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 117
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8091, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 118
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 119
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x8092, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 120
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8093, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 121
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8094, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 122
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8095, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 123
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8096, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 124
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x8097, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 125
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 126
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // row 127
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8098, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 128
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x8099,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 129
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x809a, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 130
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 131
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x809b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 132
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x809c, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 133
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x809d, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 134
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 135
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x809e, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 136
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x809f, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 137
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80a0, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 138
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80a1, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 139
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x80a2, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 140
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 141
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x80a3, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 142
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 143
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 144
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x80a4, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 145
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 146
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x80a5, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 147
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x80a6, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 148
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80a7,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 149
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x80a8, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 150
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x80a9, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 151
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80aa,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 152
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 153
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x80ab, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 154
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 155
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80ac,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 156
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 157
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80ad, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 158
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 159
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x80ae, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 160
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x80af, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 161
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x80b0, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 162
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 163
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 164
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b1, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 165
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b2, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 166
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b3, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 167
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x80b4, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 168
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b5, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 169
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b6, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 170
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x80b7, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 171
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80b8, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 172
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x80b9, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 173
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 174
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 175
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80ba, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 176
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 177
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x80bb, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 178
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 179
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 180
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 181
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 182
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x80bc, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 183
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 184
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x80bd, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 185
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x80be, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 186
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 187
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 188
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 189
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+    // row 190
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x802b,
+    0x0000, 0x0000, 0x0000, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b, 0x802b,
+    0x802b, 0x802b, 0x0000, 0x0000, 0x0000,
+};
+
+static const uint16_t s_languageTokenTypes[LANGUAGE_TABLE_ROWS] = {
+    NOT_ACCEPTING,
+    NOT_ACCEPTING,
+    TokenType::OpenParentheses,
+    TokenType::CloseParentheses,
+    TokenType::OpenBracket,
+    TokenType::CloseBracket,
+    TokenType::OpenCurley,
+    TokenType::CloseCurley,
+    TokenType::Semicolon,
+    TokenType::Colon,
+    TokenType::Comma,
+    TokenType::Dot,
+    TokenType::Plus,
+    TokenType::Minus,
+    TokenType::Asterisk,
+    TokenType::Divide,
+    TokenType::Modulo,
+    TokenType::Ampersand,
+    TokenType::LogicalNot,
+    TokenType::Assignment,
+    TokenType::LessThan,
+    TokenType::GreaterThan,
+    TokenType::LogicalOr,
+    TokenType::IntegerLiteral,
+    NOT_ACCEPTING,
+    NOT_ACCEPTING,
+    TokenType::Whitespace,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Increment,
+    TokenType::AssignmentPlus,
+    TokenType::Arrow,
+    TokenType::Decrement,
+    TokenType::AssignmentMinus,
+    TokenType::AssignmentMultiply,
+    TokenType::AssignmentDivide,
+    NOT_ACCEPTING,
+    NOT_ACCEPTING,
+    TokenType::AssignmentModulo,
+    TokenType::LogicalAnd,
+    TokenType::Inequality,
+    TokenType::Equality,
+    TokenType::LessThanOrEqualTo,
+    TokenType::ShiftLeft,
+    TokenType::GreaterThanOrEqualTo,
+    NOT_ACCEPTING,
+    TokenType::StringLiteral,
+    NOT_ACCEPTING,
+    TokenType::CharacterLiteral,
+    NOT_ACCEPTING,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::If,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Do,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::As,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    NOT_ACCEPTING,
+    TokenType::SingleLineComment,
+    TokenType::ShiftLeftAssign,
+    TokenType::FloatLiteral,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Var,
+    TokenType::Identifier,
+    TokenType::For,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Ref,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::New,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::MultiLineComment,
+    TokenType::FloatLiteral,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Case,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Else,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Goto,
+    TokenType::Identifier,
+    TokenType::Loop,
+    TokenType::True,
+    TokenType::Identifier,
+    TokenType::Null,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Class,
+    TokenType::Identifier,
+    TokenType::Const,
+    TokenType::Identifier,
+    TokenType::False,
+    TokenType::Identifier,
+    TokenType::While,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Break,
+    TokenType::Label,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Import,
+    TokenType::Delete,
+    TokenType::Identifier,
+    TokenType::Return,
+    TokenType::Identifier,
+    TokenType::Sizeof,
+    TokenType::Struct,
+    TokenType::Static,
+    TokenType::Switch,
+    TokenType::Identifier,
+    TokenType::Public,
+    TokenType::Identifier,
+    TokenType::Identifier,
+    TokenType::Default,
+    TokenType::Typedef,
+    TokenType::Private,
+    TokenType::Continue,
+    TokenType::Function,
+};
+
+static const uint8_t s_languageSpansToEnd[LANGUAGE_TABLE_ROWS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const DfaRun s_languageRuns[LANGUAGE_TABLE_ROWS] = {
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 34, 92, 0, }, 3, false },
+    { { 0, 39, 92, 0, }, 3, false },
+    { { 9, 10, 13, 32, }, 4, true },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 42, 0, 0, }, 2, false },
+    { { 0, 10, 13, 0, }, 3, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+    { { 0, 0, 0, 0, }, 0, false },
+};
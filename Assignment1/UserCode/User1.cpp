@@ -4,41 +4,91 @@
 \******************************************************************/
 
 #include <assert.h>
+#include <errno.h>
+#include <float.h>
+#include <locale.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <map>
-#include "../Drivers/Driver1.hpp"
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "User1.hpp"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #if defined(__APPLE__)
+        #include <xlocale.h>
+    #endif
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+    #define LEXER_X86 1
+    #include <emmintrin.h>
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define LEXER_TARGET_AVX2
+        #define LEXER_ALIGNED_OVERREAD
+    #else
+        #define LEXER_TARGET_AVX2 __attribute__((target("avx2")))
+        // the vector kernels read whole aligned blocks past the end on purpose
+        #define LEXER_ALIGNED_OVERREAD __attribute__((no_sanitize_address, no_sanitize_thread))
+    #endif
+    // the SSE2 kernels are built for the baseline target, 32 bit builds
+    // only have them when the compiler may assume SSE2
+    #if defined(__SSE2__) || defined(_M_X64) || _M_IX86_FP >= 2
+        #define LEXER_SSE2 1
+    #endif
+#endif
 
 //=========================================================
 // Private vars and types
 //
 
 static const int NOT_ACCEPTING           = 0;
-static const int MAX_STATES              = 512;
-static const int MAX_EDGES               = 1024;
 static const char DEFAULT_EDGE_CONDITION = CHAR_MAX;
 
+// frozen table entries: row 0 is the dead state, the high bits mark an
+// accepting target and a target with a skippable run so the scan loop
+// needs a single load per byte
+static const uint16_t DEAD_STATE         = 0;
+static const uint16_t ACCEPTING_BIT      = 0x8000;
+static const uint16_t RUN_BIT            = 0x4000;
+static const uint16_t STATE_MASK         = 0x3FFF;
+static const int MAX_RUN_BYTES           = 4;
+
 class DfaState;
 struct DfaEdge;
+struct DfaTable;
 
-static DfaState * s_states = nullptr;
-static int s_stateIndex    = 0;
-static DfaEdge * s_edges = nullptr;
-static int s_edgeIndex = 0;
-static std::map<std::string, unsigned> s_keywordToId;
-
-typedef bool (*EdgeCondition)(const DfaEdge * edge,  char c);
-
-static const char * s_tokenSymbols[] = {
+static constexpr const char * s_tokenSymbols[] = {
     #define TOKEN(Name, Value) Value,
     #include "../Drivers/TokenSymbols.inl"
     #undef TOKEN
 };
 
-static const char * s_tokenKeywords[] = {
+static constexpr const char * s_tokenKeywords[] = {
     #define TOKEN(Name, Value) Value,
     #include "../Drivers/TokenKeywords.inl"
     #undef TOKEN
 };
 
+static const unsigned KEYWORD_COUNT = sizeof(s_tokenKeywords) / sizeof(s_tokenKeywords[0]);
+
 
 //=========================================================
 struct DfaEdge {
@@ -59,15 +109,96 @@ public:
 
     unsigned int m_tokenType;
     bool m_accepting;
+    // the body of a comment or string, input that runs out here is one
+    // token to the end instead of backing off. Only CreateLanguageDfa sets it.
+    bool m_spansToEnd;
+
+    // set by FreezeDfa, row of this state in the frozen table
+    const DfaTable * m_table;
+    uint16_t m_tableIndex;
+};
+
+//=========================================================
+// a self looping state that is entered or left by a handful of bytes,
+// e.g. whitespace or the body of a comment, scanned in vector strides
+struct DfaRun {
+    uint8_t m_bytes[MAX_RUN_BYTES];
+    uint8_t m_byteCount;
+    // m_bytes keep us in the state rather than leave it
+    bool m_stay;
+};
+
+typedef const char * (*RunSkipper)(const char * stream, const char * end, const DfaRun & run);
+
+//=========================================================
+// dense form of a state graph, next[state][class of byte]. Bytes no row
+// tells apart share a class, so rows are a few dozen entries wide.
+struct DfaTable {
+    // what the scanners read, points into the storage below or at the
+    // generated language table
+    const uint16_t * m_next;
+    const uint16_t * m_tokenType;
+    // nonzero for rows of states with m_spansToEnd
+    const uint8_t * m_spansToEnd;
+    // indexed by row, only valid for targets flagged with RUN_BIT
+    const DfaRun * m_runs;
+    const uint8_t * m_classMap;
+    uint16_t m_rowCount;
+    uint16_t m_classCount;
+    RunSkipper m_skipRun;
+
+    // tables built at run time, m_nextStorage is 256 wide until the table
+    // is finished
+    std::vector<uint16_t> m_nextStorage;
+    std::vector<uint16_t> m_tokenTypeStorage;
+    std::vector<uint8_t> m_spansToEndStorage;
+    std::vector<DfaRun> m_runStorage;
+    std::vector<uint8_t> m_classMapStorage;
+
+    // tables loaded from a file point into its mapping
+    std::unique_ptr<MappedSource> m_source;
+};
+
+//=========================================================
+// Layout of a saved table. Sections are found by their offset from the
+// start of the file so it can be mapped anywhere, all fields are in the
+// byte order of the machine that wrote it.
+struct DfaFileHeader {
+    uint32_t m_magic;
+    uint16_t m_version;
+    uint16_t m_byteOrder;
+    uint32_t m_rowCount;
+    uint32_t m_classCount;
+    uint32_t m_rootRow;
+    uint32_t m_classMapOffset;
+    uint32_t m_nextOffset;
+    uint32_t m_tokenTypeOffset;
+    uint32_t m_spansToEndOffset;
+    uint32_t m_runsOffset;
+    uint32_t m_fileSize;
+};
+
+static const uint32_t DFA_FILE_MAGIC       = 0x41464444; // "DDFA"
+static const uint16_t DFA_FILE_VERSION     = 4;
+static const uint16_t DFA_FILE_BYTE_ORDER  = 0x0102;
+// sections start on a cache line
+static const uint32_t DFA_FILE_ALIGNMENT   = 64;
+
+static_assert(sizeof(DfaRun) == MAX_RUN_BYTES + 2, "runs are saved as raw bytes");
+
+//=========================================================
+// position of a walk over a frozen table
+struct DfaCursor {
+    uint16_t m_state;
+    uint16_t m_acceptingState;
+    const char * m_acceptingEnd;
 };
 
 //=========================================================
 struct DfaTokenReader {
     const char * m_stream;
     int m_tokenLength;
-    DfaState * m_lastAcceptingState;
-    DfaState * m_nextAcceptingState;
-    bool m_error;
+    unsigned int m_tokenType;
 };
 
 //=========================================================
@@ -80,7 +211,7 @@ static bool SimpleEdgeCondition (const DfaEdge * edge, char c) {
 }
 
 //=========================================================
-static bool WhiteSpaceEdgeCondition (const DfaEdge * edge, char c) {
+static bool IsWhiteSpaceChar (char c) {
     return  c == ' '  ||
             c == '\r' ||
             c == '\n' ||
@@ -88,18 +219,18 @@ static bool WhiteSpaceEdgeCondition (const DfaEdge * edge, char c) {
 }
 
 //=========================================================
-static bool AlphaEdgeCondition (const DfaEdge * edge, char c) {
-    return c >= 'a' && c <= 'z' ||
-           c >= 'A' && c <= 'Z';
+static bool IsAlphaChar (char c) {
+    return (c >= 'a' && c <= 'z') ||
+           (c >= 'A' && c <= 'Z');
 }
 
 //=========================================================
-static bool IntegerEdgeCondition (const DfaEdge * edge, char c) {
+static bool IsIntegerChar (char c) {
     return c >= '0' && c <= '9';
 }
 
 //=========================================================
-static bool EscapedCharEdgeCondition (const DfaEdge * edge, char c) {
+static bool IsEscapedChar (char c) {
     return  c == 'n' ||
             c == 'r' ||
             c == 't' ||
@@ -107,23 +238,44 @@ static bool EscapedCharEdgeCondition (const DfaEdge * edge, char c) {
 }
 
 //=========================================================
-static bool EndOfLineEdgeCondition(const DfaEdge * edge, char c) {
+static bool IsEndOfLineChar (char c) {
     return  c == '\n' ||
             c == '\r' ||
             c == '\0';
 }
 
 //=========================================================
-static void InternalAddEdge (DfaState * from, DfaState * to, char c, EdgeCondition condition) {
-    assert(s_edgeIndex < MAX_EDGES);
-    if (!s_edges) {
-        static DfaEdge edges[MAX_EDGES];
-        s_edges = edges;
-        memset(s_edges, 0, sizeof(s_edges) / sizeof(s_edges[0]));
-    }
+static bool WhiteSpaceEdgeCondition (const DfaEdge * edge, char c) {
+    return IsWhiteSpaceChar(c);
+}
+
+//=========================================================
+static bool AlphaEdgeCondition (const DfaEdge * edge, char c) {
+    return IsAlphaChar(c);
+}
+
+//=========================================================
+static bool IntegerEdgeCondition (const DfaEdge * edge, char c) {
+    return IsIntegerChar(c);
+}
+
+//=========================================================
+static bool EscapedCharEdgeCondition (const DfaEdge * edge, char c) {
+    return IsEscapedChar(c);
+}
+
+//=========================================================
+static bool EndOfLineEdgeCondition(const DfaEdge * edge, char c) {
+    return IsEndOfLineChar(c);
+}
+
+//=========================================================
+void DfaContext::InternalAddEdge (DfaState * from, DfaState * to, char c, EdgeCondition condition) {
+    // frozen graphs are read from their table, edits would be lost
+    assert(!from->m_table);
 
     // link new edge in state
-    DfaEdge * edge = &s_edges[s_edgeIndex++];
+    DfaEdge * edge = m_edges.Allocate();
     if (c == DEFAULT_EDGE_CONDITION) {
         // make sure we haven't defined a default edge already
         assert(!from->m_defaultEdge);
@@ -142,276 +294,2905 @@ static void InternalAddEdge (DfaState * from, DfaState * to, char c, EdgeConditi
 }
 
 //=========================================================
-static void InternalResetEdge (DfaEdge * edge) {
-    edge->m_condition = 0;
-    edge->m_state = nullptr;
-    edge->m_simpleCondition = 0;
-    edge->m_nextSibling = nullptr;
+// first matching sibling wins, otherwise fall back on the default edge
+static DfaEdge * InternalFindEdge (DfaState * state, char c) {
+    DfaEdge * edge = state->m_edge;
+    while (edge && !edge->m_condition(edge, c)) {
+        edge = edge->m_nextSibling;
+    }
+    return edge ? edge : state->m_defaultEdge;
 }
 
 //=========================================================
-static void InternalDeleteStateAndChildren (DfaState * state, DfaState *& newRoot) {
-    DfaEdge ** curr = &state->m_edge;
-    while (*curr) {
-        if ((*curr)->m_state != state) {
-            InternalDeleteStateAndChildren((*curr)->m_state, newRoot);
+// maximal munch over the graph, the last accepting state is kept in
+// locals so long tokens cost no stack
+static void InternalParseToken (DfaTokenReader * reader, DfaState * state) {
+    const char * stream = reader->m_stream;
+
+    DfaState * acceptingState = state->m_accepting ? state : nullptr;
+    int acceptingLength = 0;
+
+    int streamOffset = 0;
+    for (;;) {
+        char c = stream[streamOffset];
+        DfaEdge * edge = InternalFindEdge(state, c);
+
+        if (c == '\0') {
+            // ran out of input mid token, same rules as InternalFinishWalk
+            if (state->m_spansToEnd) {
+                DfaState * endState = state->m_accepting ? state : nullptr;
+                if (!endState && edge && edge->m_state->m_accepting) {
+                    endState = edge->m_state;
+                }
+                reader->m_tokenType = endState ? endState->m_tokenType : NOT_ACCEPTING;
+                reader->m_tokenLength = streamOffset;
+                return;
+            }
+            break;
         }
-        InternalResetEdge(*curr);
-        *curr = nullptr;
-    }
-    if (state->m_defaultEdge) {
-        if (state->m_defaultEdge->m_state != state) {
-            InternalDeleteStateAndChildren(state->m_defaultEdge->m_state, newRoot);
+        if (!edge) {
+            break;
+        }
+
+        state = edge->m_state;
+        ++streamOffset;
+        if (state->m_accepting) {
+            acceptingState = state;
+            acceptingLength = streamOffset;
         }
-        InternalResetEdge(state->m_defaultEdge);
-        state->m_defaultEdge = nullptr;
     }
-    state->m_accepting = false;
-    state->m_tokenType = (TokenType::Enum) 0;
-    newRoot = state;
+
+    // an unmatched token spans everything we read
+    reader->m_tokenType = acceptingState ? acceptingState->m_tokenType : NOT_ACCEPTING;
+    reader->m_tokenLength = acceptingLength ? acceptingLength : streamOffset;
 }
 
 //=========================================================
-static void InternalParseToken (DfaTokenReader * reader, DfaState * state, int streamOffset) {
-    // save position if this state is accepting
-    if (state->m_accepting) {
-        // this is a signal to previous callers
-        reader->m_nextAcceptingState = state;
+static unsigned InternalLowestBit (uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
 
-        reader->m_lastAcceptingState = state;
-        reader->m_tokenLength = streamOffset;
+//=========================================================
+static bool InternalRunContinues (const DfaRun & run, unsigned char c) {
+    bool listed = false;
+    for (int i = 0; i < run.m_byteCount; ++i) {
+        listed |= run.m_bytes[i] == c;
     }
+    return listed == run.m_stay;
+}
 
-    if (*(reader->m_stream + streamOffset) == '\0') {
-        if (!reader->m_tokenLength) {
-            reader->m_tokenLength = streamOffset;
-        }
-        return;
+//=========================================================
+// end is null for NUL terminated streams, where the run lists NUL as an exit
+static const char * InternalSkipRunScalar (const char * stream, const char * end, const DfaRun & run) {
+    while (stream != end && InternalRunContinues(run, *stream)) {
+        ++stream;
+    }
+    return stream;
+}
+
+#if LEXER_SSE2
+//=========================================================
+// loads are aligned so reading past the end never crosses into another page,
+// bytes before the stream and after end are masked off
+LEXER_ALIGNED_OVERREAD
+static const char * InternalSkipRunSse2 (const char * stream, const char * end, const DfaRun & run) {
+    // the block holding end may lie on an unmapped page
+    if (stream == end) {
+        return end;
     }
+    const __m128i b0 = _mm_set1_epi8(run.m_bytes[0]);
+    const __m128i b1 = _mm_set1_epi8(run.m_bytes[run.m_byteCount > 1 ? 1 : 0]);
+    const __m128i b2 = _mm_set1_epi8(run.m_bytes[run.m_byteCount > 2 ? 2 : 0]);
+    const __m128i b3 = _mm_set1_epi8(run.m_bytes[run.m_byteCount > 3 ? 3 : 0]);
+    const uint32_t flip = run.m_stay ? 0xFFFF : 0;
 
-    // look at outgoing edges to find next match
-    DfaEdge * edge = state->m_edge;
-    bool foundEdge = false;
-    while (edge) {
-        char c = *(reader->m_stream + streamOffset);
-        if (edge->m_condition(edge, c)) {
-            reader->m_nextAcceptingState = nullptr;
-            InternalParseToken(reader, edge->m_state, streamOffset + 1);
-            if (!reader->m_nextAcceptingState) {
-                reader->m_error = true;
-            }
-            foundEdge = true;
-            break;
+    unsigned misalignment = (uintptr_t)stream & 15;
+    const char * block = stream - misalignment;
+    uint32_t skip = ~0u << misalignment;
+    for (;;) {
+        __m128i bytes = _mm_load_si128((const __m128i *)block);
+        __m128i listed = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, b0), _mm_cmpeq_epi8(bytes, b1)),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, b2), _mm_cmpeq_epi8(bytes, b3))
+        );
+        uint32_t exits = ((uint32_t)_mm_movemask_epi8(listed) ^ flip) & skip;
+        if (exits) {
+            const char * exit = block + InternalLowestBit(exits);
+            return end && exit > end ? end : exit;
         }
-        edge = edge->m_nextSibling;
+        block += 16;
+        if (end && block >= end) {
+            return end;
+        }
+        skip = ~0u;
     }
+}
+#endif
 
-    // if we didn't find an edge, see if we have a default edge and check that
-    if (state->m_defaultEdge && !reader->m_error && !foundEdge) {
-        assert(state->m_defaultEdge->m_condition(state->m_defaultEdge, DEFAULT_EDGE_CONDITION));
-        InternalParseToken(reader, state->m_defaultEdge->m_state, streamOffset + 1);
+#if LEXER_X86
+//=========================================================
+LEXER_TARGET_AVX2 LEXER_ALIGNED_OVERREAD
+static const char * InternalSkipRunAvx2 (const char * stream, const char * end, const DfaRun & run) {
+    if (stream == end) {
+        return end;
     }
+    const __m256i b0 = _mm256_set1_epi8(run.m_bytes[0]);
+    const __m256i b1 = _mm256_set1_epi8(run.m_bytes[run.m_byteCount > 1 ? 1 : 0]);
+    const __m256i b2 = _mm256_set1_epi8(run.m_bytes[run.m_byteCount > 2 ? 2 : 0]);
+    const __m256i b3 = _mm256_set1_epi8(run.m_bytes[run.m_byteCount > 3 ? 3 : 0]);
+    const uint32_t flip = run.m_stay ? ~0u : 0;
 
-    if (!reader->m_tokenLength) {
-        reader->m_tokenLength = streamOffset;
+    unsigned misalignment = (uintptr_t)stream & 31;
+    const char * block = stream - misalignment;
+    uint32_t skip = ~0u << misalignment;
+    for (;;) {
+        __m256i bytes = _mm256_load_si256((const __m256i *)block);
+        __m256i listed = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, b0), _mm256_cmpeq_epi8(bytes, b1)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, b2), _mm256_cmpeq_epi8(bytes, b3))
+        );
+        uint32_t exits = ((uint32_t)_mm256_movemask_epi8(listed) ^ flip) & skip;
+        if (exits) {
+            const char * exit = block + InternalLowestBit(exits);
+            return end && exit > end ? end : exit;
+        }
+        block += 32;
+        if (end && block >= end) {
+            return end;
+        }
+        skip = ~0u;
     }
 }
 
 //=========================================================
-void InternalReadToken(DfaState * startingState, const char * stream, Token & outToken) {
-    outToken.mTokenType = 0;
+static bool InternalCpuHasAvx2 () {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    // the OS must save ymm registers for us
+    bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
 
-    DfaTokenReader reader;
-    reader.m_stream                = stream;
-    reader.m_lastAcceptingState    = nullptr;
-    reader.m_tokenLength = 0;
-    reader.m_error = false;
-    reader.m_nextAcceptingState = nullptr;
+//=========================================================
+static RunSkipper InternalSelectRunSkipper () {
+#if LEXER_X86
+    if (InternalCpuHasAvx2()) {
+        return &InternalSkipRunAvx2;
+    }
+#endif
+#if LEXER_SSE2
+    return &InternalSkipRunSse2;
+#endif
+    return &InternalSkipRunScalar;
+}
 
-    InternalParseToken(&reader, startingState, 0);
+//=========================================================
+// appends the offset after every newline in data[0, length)
+typedef void (*NewlineFinder)(const char * data, size_t length, std::vector<size_t> & lineStarts);
 
-    if (reader.m_lastAcceptingState) {
-        outToken.mTokenType = reader.m_lastAcceptingState->m_tokenType;
-        if (reader.m_lastAcceptingState->m_tokenType == TokenType::Identifier) {
-            std::string id(reader.m_stream, reader.m_tokenLength);
-            if (s_keywordToId.count(id)) {
-                outToken.mTokenType = s_keywordToId[id];
-            }
+//=========================================================
+static void InternalFindNewlinesScalar (const char * data, size_t length, std::vector<size_t> & lineStarts) {
+    const char * curr = data;
+    const char * end = data + length;
+    while ((curr = (const char *)memchr(curr, '\n', end - curr)) != nullptr) {
+        ++curr;
+        lineStarts.push_back(curr - data);
+    }
+}
+
+#if LEXER_SSE2
+//=========================================================
+static void InternalFindNewlinesSse2 (const char * data, size_t length, std::vector<size_t> & lineStarts) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    size_t offset = 0;
+    for (; offset + 16 <= length; offset += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(data + offset));
+        uint32_t found = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline));
+        while (found) {
+            lineStarts.push_back(offset + InternalLowestBit(found) + 1);
+            found &= found - 1;
         }
     }
-    outToken.mText   = reader.m_stream;
-    outToken.mLength = reader.m_tokenLength;
+    std::vector<size_t>::size_type tail = lineStarts.size();
+    InternalFindNewlinesScalar(data + offset, length - offset, lineStarts);
+    for (; tail < lineStarts.size(); ++tail) {
+        lineStarts[tail] += offset;
+    }
 }
+#endif
 
+#if LEXER_X86
 //=========================================================
-// Public Methods
-//
+LEXER_TARGET_AVX2
+static void InternalFindNewlinesAvx2 (const char * data, size_t length, std::vector<size_t> & lineStarts) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    size_t offset = 0;
+    for (; offset + 32 <= length; offset += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *)(data + offset));
+        uint32_t found = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newline));
+        while (found) {
+            lineStarts.push_back(offset + InternalLowestBit(found) + 1);
+            found &= found - 1;
+        }
+    }
+    std::vector<size_t>::size_type tail = lineStarts.size();
+    InternalFindNewlinesScalar(data + offset, length - offset, lineStarts);
+    for (; tail < lineStarts.size(); ++tail) {
+        lineStarts[tail] += offset;
+    }
+}
+#endif
 
 //=========================================================
-DfaState * AddState (int acceptingToken) {
-    assert(s_stateIndex < MAX_STATES);
-    if (s_states == nullptr) {
-        static DfaState state_pool[MAX_STATES];
-        memset(state_pool, 0, sizeof(state_pool) / sizeof(state_pool[0]));
-        s_states = state_pool;
+static NewlineFinder InternalSelectNewlineFinder () {
+#if LEXER_X86
+    if (InternalCpuHasAvx2()) {
+        return &InternalFindNewlinesAvx2;
     }
+#endif
+#if LEXER_SSE2
+    return &InternalFindNewlinesSse2;
+#endif
+    return &InternalFindNewlinesScalar;
+}
 
-    DfaState * state = &s_states[s_stateIndex++];
-    state->m_accepting = acceptingToken != NOT_ACCEPTING;
-    state->m_tokenType = acceptingToken;
-    state->m_edge = nullptr;
+//=========================================================
+static uint16_t InternalEntry (const DfaTable * table, size_t row, unsigned char c) {
+    return table->m_next[row * table->m_classCount + table->m_classMap[c]];
+}
 
-    return state;
+//=========================================================
+// terminated streams stop at NUL, otherwise the walk stops at end and NUL
+// is an ordinary byte. Returns where the walk stopped, the cursor state is
+// the dead state if a transition failed and is live if input ran out.
+template <bool Terminated>
+static const char * InternalWalkFrozen (const DfaTable * table, DfaCursor & cursor, const char * curr, const char * end) {
+    const uint16_t * next = table->m_next;
+    const uint8_t * classMap = table->m_classMap;
+    const size_t classCount = table->m_classCount;
+    uint16_t state = cursor.m_state;
+
+    while (Terminated ? *curr != '\0' : curr != end) {
+        uint16_t entry = next[state * classCount + classMap[(unsigned char)*curr]];
+        if (entry == DEAD_STATE) {
+            cursor.m_state = DEAD_STATE;
+            return curr;
+        }
+        state = entry & STATE_MASK;
+        ++curr;
+        if (entry & RUN_BIT) {
+            const DfaRun & run = table->m_runs[state];
+            // most whitespace runs are a single byte, don't pay for a vector load
+            if ((Terminated || curr != end) && InternalRunContinues(run, *curr)) {
+                curr = table->m_skipRun(curr + 1, Terminated ? nullptr : end, run);
+            }
+        }
+        if (entry & ACCEPTING_BIT) {
+            cursor.m_acceptingState = state;
+            cursor.m_acceptingEnd = curr;
+        }
+    }
+
+    cursor.m_state = state;
+    return curr;
 }
 
 //=========================================================
-void AddEdge (DfaState * from, DfaState * to, char c) {
-    assert(from && to && c != DEFAULT_EDGE_CONDITION);
-    InternalAddEdge(from, to, c, nullptr);
+static void InternalStartCursor (const DfaTable * table, uint16_t state, const char * stream, DfaCursor & cursor) {
+    cursor.m_state = state;
+    cursor.m_acceptingState = table->m_tokenType[state] != NOT_ACCEPTING ? state : DEAD_STATE;
+    cursor.m_acceptingEnd = stream;
 }
 
 //=========================================================
-void AddDefaultEdge (DfaState * from, DfaState * to) {
-    assert(from && to);
-    InternalAddEdge(from, to, DEFAULT_EDGE_CONDITION, nullptr);
+// Type of a token that spans to the end. The end of input reads as a NUL,
+// so a line comment can end a file, and an unclosed comment or string is
+// invalid.
+static unsigned int InternalEndOfInputType (const DfaTable * table, uint16_t state) {
+    if (table->m_tokenType[state] != NOT_ACCEPTING) {
+        return table->m_tokenType[state];
+    }
+    uint16_t entry = InternalEntry(table, state, '\0');
+    return (entry & ACCEPTING_BIT) ? table->m_tokenType[entry & STATE_MASK] : NOT_ACCEPTING;
 }
 
 //=========================================================
-void ReadToken(DfaState * startingState, const char * stream, Token & outToken) {
-    InternalReadToken(startingState, stream, outToken);
+// Whether a token that input ran out in spans to the end. Only the bodies
+// of comments and strings that CreateLanguageDfa flags do, an unclosed one
+// near the top of a large file is then a single token rather than one that
+// backs off and has the next tokens read the same tail again. Any other
+// walk backs off to its last accept, so "1." at the end is still an
+// integer and a dot.
+static bool InternalSpansToEnd (const DfaTable * table, uint16_t state) {
+    return state != DEAD_STATE && table->m_spansToEnd[state];
 }
 
 //=========================================================
-void DeleteStateAndChildren (DfaState * root) {
-    DfaState * newRoot = nullptr;
-    InternalDeleteStateAndChildren(root, newRoot);
+// token a walk from stream ended with. A walk that died backs off to its
+// last accept, one that ran out of input does too unless InternalSpansToEnd.
+static size_t InternalFinishWalk (
+    const DfaTable * table,
+    const DfaCursor & cursor,
+    const char * stream,
+    const char * stop,
+    unsigned int & outTokenType
+) {
+    if (InternalSpansToEnd(table, cursor.m_state)) {
+        outTokenType = InternalEndOfInputType(table, cursor.m_state);
+        return stop - stream;
+    }
 
-    // see if we get back to the beginning of our pool
-    // could just zero memory...
-    s_stateIndex = newRoot - s_states;
-    assert(s_stateIndex == 0);
-    s_keywordToId.clear();
+    // same length rules as the graph walk
+    outTokenType = table->m_tokenType[cursor.m_acceptingState];
+    return (cursor.m_acceptingEnd != stream ? cursor.m_acceptingEnd : stop) - stream;
 }
 
 //=========================================================
-void ReadLanguageToken(DfaState * startingState, const char * stream, Token & outToken) {
-    InternalReadToken(startingState, stream, outToken);
+template <bool Terminated>
+static size_t InternalScanFrozen (const DfaTable * table, uint16_t state, const char * stream, const char * end, unsigned int & outTokenType) {
+    DfaCursor cursor;
+    InternalStartCursor(table, state, stream, cursor);
+    const char * stop = InternalWalkFrozen<Terminated>(table, cursor, stream, end);
+    return InternalFinishWalk(table, cursor, stream, stop, outTokenType);
 }
 
 //=========================================================
-DfaState* CreateLanguageDfa() {
-    DfaState * root = AddState(NOT_ACCEPTING);
+// language token for a scanned span, zero length spans become a one byte
+// invalid token so bulk loops always make progress
+static Token InternalMakeToken (const char * text, size_t length, unsigned int tokenType) {
+    if (!length) {
+        length = 1;
+    }
 
-    // store out symbol states
-    std::map<std::string, DfaState *> symbolStates;
+    Token token;
+    token.mText = text;
+    token.mLength = length;
+    token.mTokenType = tokenType;
+    return token;
+}
 
-    // find max symbol size
-    int maxLength = 0;
-    for (int i = 0; i < sizeof(s_tokenSymbols) / sizeof(s_tokenSymbols[0]); ++i) {
-        const char * symbol = s_tokenSymbols[i];
-        int l = strlen(symbol);
-        if (l > maxLength) {
-            maxLength = l;
+//=========================================================
+// Bulk lexing hands every token to a sink while its bytes are still in
+// cache. A sink has Add(token) and Count(), the tokens it kept, and can
+// size itself in Reserve(expected tokens) and note where each input starts
+// in StartInput(index).
+struct InternalTokenSink {
+    void Reserve (size_t count) {}
+    void StartInput (size_t index) {}
+};
+
+//=========================================================
+struct InternalVectorSink : InternalTokenSink {
+    explicit InternalVectorSink (std::vector<Token> & tokens) :
+        m_tokens(tokens),
+        m_first(tokens.size())
+    {}
+
+    void Reserve (size_t count) { m_tokens.reserve(m_first + count); }
+    void Add (const Token & token) { m_tokens.push_back(token); }
+    size_t Count () const { return m_tokens.size() - m_first; }
+
+    std::vector<Token> & m_tokens;
+    size_t m_first;
+};
+
+//=========================================================
+// Keeps bulk lexing linear when a graph backs off a long way, e.g. "aaa..."
+// for a and a a* b, where every token would read the rest of the input.
+// A walk that backed off past the bytes after its last accept leaves the
+// (state, position) pairs it went through there, and no accept is
+// reachable from any of them. A later walk that reaches one backs off the
+// same way, so it stops there. Every pair is recorded once and the tokens
+// are the same as without it.
+struct InternalFailedWalks {
+    explicit InternalFailedWalks (const char * base) :
+        m_base(base),
+        m_end(base)
+    {}
+
+    // whether a walk from curr can reach a recorded pair, forgets them
+    // once lexing has moved past the last one
+    bool Covers (const char * curr) {
+        if (curr < m_end) {
+            return true;
         }
+        if (!m_pairs.empty()) {
+            m_pairs.clear();
+        }
+        return false;
     }
 
-    // create symbol dfa
-    for (int tokenLength = 1; tokenLength <= maxLength; ++tokenLength) {
-        for (int i = 0; i < sizeof(s_tokenSymbols) / sizeof(s_tokenSymbols[0]); ++i) {
-            const char * symbol = s_tokenSymbols[i];
-            if (strlen(symbol) == tokenLength) {
-                DfaState * newState = AddState(TokenType::SymbolStart + 1 + i);
-                std::string tokenBuffer(symbol);
-                if (tokenBuffer.size() > 1) {
-                    tokenBuffer.pop_back();
-                }
-                auto parentState = symbolStates.find(tokenBuffer);
-                char edgeChar = *(symbol + tokenLength - 1);
-                if (parentState != symbolStates.end()) {
-                    AddEdge(parentState->second, newState, edgeChar);
-                }
-                else {
-                    AddEdge(root, newState, *symbol);
-                }
-                symbolStates[symbol] = newState;
+    // InternalWalkFrozen<false> one byte at a time, stopping on a recorded
+    // pair once the walk has accepted
+    const char * Walk (const DfaTable * table, DfaCursor & cursor, const char * stream, const char * end) const {
+        uint16_t state = cursor.m_state;
+        const char * curr = stream;
+        while (curr != end) {
+            uint16_t entry = InternalEntry(table, state, (unsigned char)*curr);
+            if (entry == DEAD_STATE) {
+                cursor.m_state = DEAD_STATE;
+                return curr;
+            }
+            state = entry & STATE_MASK;
+            ++curr;
+            if (entry & ACCEPTING_BIT) {
+                cursor.m_acceptingState = state;
+                cursor.m_acceptingEnd = curr;
+            }
+            else if (cursor.m_acceptingEnd != stream && m_pairs.count(Key(curr, state))) {
+                cursor.m_state = DEAD_STATE;
+                return curr;
             }
         }
+        cursor.m_state = state;
+        return curr;
     }
 
-    DfaState * whiteSpace = AddState(TokenType::Whitespace);
-    DfaState * identifier = AddState(TokenType::Identifier);
-    DfaState * integerLiteral = AddState (TokenType::IntegerLiteral);
-    DfaState * floatLiteral = AddState(TokenType::FloatLiteral);
-    DfaState * stringLiteral = AddState(TokenType::StringLiteral);
-    DfaState * charLiteral = AddState(TokenType::CharacterLiteral);
-    DfaState * multiComment = AddState(TokenType::MultiLineComment);
-    DfaState * singleComment = AddState(TokenType::SingleLineComment);
+    // a walk that stopped at stop backed off to tokenEnd, in state
+    void Record (const DfaTable * table, uint16_t state, const char * tokenEnd, const char * stop) {
+        const char * curr = tokenEnd;
+        while (curr != stop) {
+            state = InternalEntry(table, state, (unsigned char)*curr) & STATE_MASK;
+            ++curr;
+            // the rest of the walk was recorded before
+            if (!m_pairs.insert(Key(curr, state)).second) {
+                break;
+            }
+        }
+        m_end = std::max(m_end, curr);
+    }
 
-    // integer
-    InternalAddEdge(root, integerLiteral, 0, IntegerEdgeCondition);
-    InternalAddEdge(integerLiteral, integerLiteral, 0, IntegerEdgeCondition);
+    uint64_t Key (const char * curr, uint16_t state) const {
+        return (uint64_t)(curr - m_base) << 16 | state;
+    }
 
-    // float
-    DfaState * floatDot = AddState(NOT_ACCEPTING);
-    InternalAddEdge(integerLiteral, floatDot, '.', nullptr);
-    InternalAddEdge(floatDot, floatLiteral, 0, IntegerEdgeCondition);
-    InternalAddEdge(floatLiteral, floatLiteral, 0, IntegerEdgeCondition);
-    InternalAddEdge(floatLiteral, floatLiteral, 'e', nullptr);
-    InternalAddEdge(floatLiteral, floatLiteral, '+', nullptr);
-    InternalAddEdge(floatLiteral, floatLiteral, '-', nullptr);
-    DfaState * floatLiteralEnd = AddState(TokenType::FloatLiteral);
-    InternalAddEdge(floatLiteral, floatLiteralEnd, 'f', nullptr);
+    std::unordered_set<uint64_t> m_pairs;
+    const char * m_base;
+    // one past the last recorded position
+    const char * m_end;
+};
 
-    // string literal
-    DfaState * stringLiteralStart = AddState(NOT_ACCEPTING);
-    InternalAddEdge(root, stringLiteralStart, '"', nullptr);
-    InternalAddEdge(stringLiteralStart, stringLiteral, '"', nullptr);
-    DfaState * slEscaped = AddState(NOT_ACCEPTING);
-    InternalAddEdge(stringLiteralStart, slEscaped, '\\', nullptr);
-    InternalAddEdge(slEscaped, stringLiteralStart, 0, EscapedCharEdgeCondition);
-    AddDefaultEdge(stringLiteralStart, stringLiteralStart);
+//=========================================================
+// appends the tokens starting in [begin, stop) of a buffer ending at end,
+// returns where the last one ends
+template <typename Sink>
+static const char * InternalTokenizeRange (
+    const DfaTable * table,
+    uint16_t rootIndex,
+    const char * begin,
+    const char * stop,
+    const char * end,
+    Sink & sink
+) {
+    InternalFailedWalks failedWalks(begin);
+    const char * curr = begin;
+    while (curr < stop) {
+        DfaCursor cursor;
+        InternalStartCursor(table, rootIndex, curr, cursor);
+        const char * walkStop = failedWalks.Covers(curr) ?
+            failedWalks.Walk(table, cursor, curr, end) :
+            InternalWalkFrozen<false>(table, cursor, curr, end);
+        unsigned int tokenType;
+        size_t tokenLength = InternalFinishWalk(table, cursor, curr, walkStop, tokenType);
+        if (curr + tokenLength < walkStop) {
+            failedWalks.Record(table, cursor.m_acceptingState, curr + tokenLength, walkStop);
+        }
 
-    // char literal
-    DfaState * charLiteralStart = AddState(NOT_ACCEPTING);
-    InternalAddEdge(root, charLiteralStart, '\'', nullptr);
-    InternalAddEdge(charLiteralStart, charLiteral, '\'', nullptr);
-    DfaState * clEscaped = AddState(NOT_ACCEPTING);
-    InternalAddEdge(charLiteralStart, clEscaped, '\\', nullptr);
-    InternalAddEdge(clEscaped, charLiteralStart, 0, EscapedCharEdgeCondition);
-    AddDefaultEdge(charLiteralStart, charLiteralStart);
+        Token token = InternalMakeToken(curr, tokenLength, tokenType);
+        sink.Add(token);
+        curr += token.mLength;
+    }
+    return curr;
+}
 
-    // multiline comment
-    DfaState * divisionState = symbolStates[s_tokenSymbols[TokenType::Divide - TokenType::SymbolStart - 1]];
-    DfaState * mlcStart = AddState(NOT_ACCEPTING);
-    DfaState * mlcStarFinder = AddState(NOT_ACCEPTING);
-    InternalAddEdge(divisionState, mlcStart, '*', nullptr);
-    InternalAddEdge(mlcStart, mlcStarFinder, '*', nullptr);
-    InternalAddEdge(mlcStarFinder, multiComment, '/', nullptr);
-    AddDefaultEdge(mlcStarFinder, mlcStart);
-    AddDefaultEdge(mlcStart, mlcStart);
+//=========================================================
+static void InternalFillStats (LexerStats * stats, size_t bytes, size_t tokenCount, std::chrono::steady_clock::time_point start) {
+    if (!stats) {
+        return;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    stats->m_bytes = bytes;
+    stats->m_tokens = tokenCount;
+    stats->m_seconds = elapsed.count();
+    stats->m_bytesPerSecond = elapsed.count() > 0.0 ? bytes / elapsed.count() : 0.0;
+}
 
-    // singleline comment
-    DfaState * slcStart = AddState(NOT_ACCEPTING);
-    InternalAddEdge(divisionState, slcStart, '/', nullptr);
-    InternalAddEdge(slcStart, singleComment, 0, EndOfLineEdgeCondition);
-    AddDefaultEdge(slcStart, slcStart);
+//=========================================================
+// the loop behind TokenizeAll and its variants, lexes the inputs in turn
+// into sink
+template <typename Sink>
+static void InternalTokenize (DfaState * root, const LexInput * inputs, size_t inputCount, Sink & sink, LexerStats * stats) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    // built automata are shared read only, they have to be frozen up front
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    const uint16_t rootIndex = root->m_tableIndex;
 
-    // whitespace
-    InternalAddEdge(root, whiteSpace, 0, WhiteSpaceEdgeCondition);
-    InternalAddEdge(whiteSpace, whiteSpace, 0, WhiteSpaceEdgeCondition);
+    // tokens average a few bytes once whitespace is counted
+    size_t bytes = 0;
+    for (size_t i = 0; i < inputCount; ++i) {
+        bytes += inputs[i].m_length;
+    }
+    sink.Reserve(bytes / 4 + inputCount);
 
-    // identifier
-    InternalAddEdge(root, identifier, 0, AlphaEdgeCondition);
-    InternalAddEdge(root, identifier, '_', nullptr);
+    for (size_t i = 0; i < inputCount; ++i) {
+        const char * end = inputs[i].m_data + inputs[i].m_length;
+        sink.StartInput(i);
+        InternalTokenizeRange(table, rootIndex, inputs[i].m_data, end, end, sink);
+    }
 
-    InternalAddEdge(identifier, identifier, 0, AlphaEdgeCondition);
-    InternalAddEdge(identifier, identifier, '_', nullptr);
-    InternalAddEdge(identifier, identifier, 0, IntegerEdgeCondition);
+    InternalFillStats(stats, bytes, sink.Count(), start);
+}
 
-    // parse keywords
-    for (unsigned i = 0; i < sizeof(s_tokenKeywords) / sizeof(s_tokenKeywords[0]); ++i) {
-        s_keywordToId[s_tokenKeywords[i]] = TokenType::KeywordStart + 1 + i;
-    }
+//=========================================================
+void InternalReadToken(DfaState * startingState, const char * stream, Token & outToken) {
+    outToken.mTokenType = 0;
 
-    return root;
+    DfaTokenReader reader;
+    reader.m_stream      = stream;
+    reader.m_tokenLength = 0;
+    reader.m_tokenType   = NOT_ACCEPTING;
+
+    if (startingState->m_table) {
+        reader.m_tokenLength = (int)InternalScanFrozen<true>(
+            startingState->m_table,
+            startingState->m_tableIndex,
+            stream,
+            nullptr,
+            reader.m_tokenType
+        );
+    }
+    else {
+        InternalParseToken(&reader, startingState);
+    }
+
+    outToken.mTokenType = reader.m_tokenType;
+    outToken.mText   = reader.m_stream;
+    outToken.mLength = reader.m_tokenLength;
+}
+
+//=========================================================
+static uint16_t InternalFreezeState (DfaState * state, std::vector<DfaState *> & order) {
+    if (!state->m_tableIndex) {
+        order.push_back(state);
+        // row 0 is reserved for the dead state
+        assert(order.size() <= STATE_MASK);
+        state->m_tableIndex = (uint16_t)order.size();
+    }
+    return state->m_tableIndex;
+}
+
+//=========================================================
+// run of a row that loops on itself for all but a few bytes, or for only a
+// few bytes, so the scanner can skip its body with SIMD compares. An empty
+// run if the row is neither.
+static DfaRun InternalRowRun (const uint16_t * next, size_t row) {
+    DfaRun run = {};
+    int stayCount = 0;
+    // NUL always ends a scan of a terminated stream
+    int exitCount = 1;
+    for (int c = 1; c < 256; ++c) {
+        if ((next[c] & STATE_MASK) == row) {
+            ++stayCount;
+        }
+        else {
+            ++exitCount;
+        }
+    }
+    if (!stayCount || (stayCount > MAX_RUN_BYTES && exitCount > MAX_RUN_BYTES)) {
+        return run;
+    }
+
+    run.m_stay = stayCount <= MAX_RUN_BYTES;
+    if (!run.m_stay) {
+        run.m_bytes[run.m_byteCount++] = '\0';
+    }
+    for (int c = 1; c < 256; ++c) {
+        if (((next[c] & STATE_MASK) == row) == run.m_stay) {
+            run.m_bytes[run.m_byteCount++] = (uint8_t)c;
+        }
+    }
+    return run;
+}
+
+//=========================================================
+// Splits the bytes into classes no row tells apart, numbered in order of
+// their lowest byte. Rows are 256 wide, returns the class count.
+static unsigned InternalByteClasses (const uint16_t * next, size_t rowCount, uint8_t * outClassMap) {
+    int lowestByte[256] = {};
+    unsigned classCount = 0;
+    for (int c = 0; c < 256; ++c) {
+        unsigned found = classCount;
+        for (unsigned k = 0; k < classCount && found == classCount; ++k) {
+            bool same = true;
+            for (size_t row = 0; row < rowCount && same; ++row) {
+                same = next[(row << 8) | c] == next[(row << 8) | lowestByte[k]];
+            }
+            found = same ? k : found;
+        }
+        if (found == classCount) {
+            lowestByte[classCount++] = c;
+        }
+        outClassMap[c] = (uint8_t)found;
+    }
+    return classCount;
+}
+
+//=========================================================
+static void InternalCompressRows (
+    const uint16_t * next,
+    size_t rowCount,
+    const uint8_t * classMap,
+    unsigned classCount,
+    uint16_t * outNext
+) {
+    for (size_t row = 0; row < rowCount; ++row) {
+        for (int c = 0; c < 256; ++c) {
+            outNext[row * classCount + classMap[c]] = next[(row << 8) | c];
+        }
+    }
+}
+
+//=========================================================
+static void InternalFindRuns (DfaTable * table) {
+    size_t rowCount = table->m_tokenTypeStorage.size();
+    table->m_runStorage.assign(rowCount, DfaRun());
+    table->m_skipRun = InternalSelectRunSkipper();
+
+    for (size_t row = 1; row < rowCount; ++row) {
+        table->m_runStorage[row] = InternalRowRun(&table->m_nextStorage[row << 8], row);
+    }
+    for (uint16_t & entry : table->m_nextStorage) {
+        if (table->m_runStorage[entry & STATE_MASK].m_byteCount) {
+            entry |= RUN_BIT;
+        }
+    }
+}
+
+//=========================================================
+static void InternalCompressClasses (DfaTable * table) {
+    size_t rowCount = table->m_tokenTypeStorage.size();
+    table->m_classMapStorage.assign(256, 0);
+    unsigned classCount = InternalByteClasses(table->m_nextStorage.data(), rowCount, table->m_classMapStorage.data());
+
+    std::vector<uint16_t> next(rowCount * classCount);
+    InternalCompressRows(table->m_nextStorage.data(), rowCount, table->m_classMapStorage.data(), classCount, next.data());
+    table->m_nextStorage.swap(next);
+    table->m_classCount = (uint16_t)classCount;
+}
+
+//=========================================================
+// finds the runs of a freshly built table, folds its bytes into classes
+// and points the views at its storage
+static void InternalFinishTable (DfaTable * table) {
+    InternalFindRuns(table);
+    InternalCompressClasses(table);
+
+    table->m_next = table->m_nextStorage.data();
+    table->m_tokenType = table->m_tokenTypeStorage.data();
+    table->m_spansToEnd = table->m_spansToEndStorage.data();
+    table->m_runs = table->m_runStorage.data();
+    table->m_classMap = table->m_classMapStorage.data();
+    table->m_rowCount = (uint16_t)table->m_tokenTypeStorage.size();
+}
+
+//=========================================================
+// Generated language table
+//
+// LanguageTable.inl is the finished table of CreateLanguageDfa as written
+// by EmitLanguageTable, so StaticLanguageDfa costs the compiler nothing to
+// build. It carries a hash of the token lists it was generated from and is
+// only used while they still match. Debug builds also compare it with a
+// fresh build on first use, which catches edits to CreateLanguageDfa.
+//
+
+static const unsigned SYMBOL_COUNT = sizeof(s_tokenSymbols) / sizeof(s_tokenSymbols[0]);
+
+//=========================================================
+// FNV-1a over the token lists, NUL terminators included
+static constexpr uint32_t InternalHashTokenList (const char * const * tokens, unsigned count, uint32_t hash) {
+    for (unsigned i = 0; i < count; ++i) {
+        const char * token = tokens[i];
+        do {
+            hash = (hash ^ (uint8_t)*token) * 16777619u;
+        } while (*token++);
+    }
+    return hash;
+}
+
+//=========================================================
+static constexpr uint32_t InternalHashTokenLists () {
+    return InternalHashTokenList(
+        s_tokenKeywords,
+        KEYWORD_COUNT,
+        InternalHashTokenList(s_tokenSymbols, SYMBOL_COUNT, 2166136261u)
+    );
+}
+
+#include "LanguageTable.inl"
+
+static const bool LANGUAGE_TABLE_CURRENT = LANGUAGE_TABLE_TOKEN_HASH == InternalHashTokenLists();
+
+//=========================================================
+static uint32_t InternalAlignOffset (size_t offset) {
+    return (uint32_t)((offset + DFA_FILE_ALIGNMENT - 1) & ~(size_t)(DFA_FILE_ALIGNMENT - 1));
+}
+
+//=========================================================
+// offsets are 32 bits in the file, compare in size_t so they cannot wrap
+static bool InternalSectionFits (uint32_t offset, size_t bytes, size_t size) {
+    return (size_t)offset <= size && bytes <= size - (size_t)offset;
+}
+
+//=========================================================
+static bool InternalValidateTable (const char * data, size_t size) {
+    if (size < sizeof(DfaFileHeader)) {
+        return false;
+    }
+    const DfaFileHeader * header = (const DfaFileHeader *)data;
+    if (header->m_magic != DFA_FILE_MAGIC ||
+        header->m_version != DFA_FILE_VERSION ||
+        header->m_byteOrder != DFA_FILE_BYTE_ORDER ||
+        header->m_fileSize != size) {
+        return false;
+    }
+
+    size_t rowCount = header->m_rowCount;
+    size_t classCount = header->m_classCount;
+    if (rowCount < 2 || rowCount > STATE_MASK || !header->m_rootRow || header->m_rootRow >= rowCount) {
+        return false;
+    }
+    if (!classCount || classCount > 256 ||
+        header->m_nextOffset % sizeof(uint16_t) || header->m_tokenTypeOffset % sizeof(uint16_t) ||
+        !InternalSectionFits(header->m_classMapOffset, 256, size) ||
+        !InternalSectionFits(header->m_nextOffset, rowCount * classCount * sizeof(uint16_t), size) ||
+        !InternalSectionFits(header->m_tokenTypeOffset, rowCount * sizeof(uint16_t), size) ||
+        !InternalSectionFits(header->m_spansToEndOffset, rowCount, size) ||
+        !InternalSectionFits(header->m_runsOffset, rowCount * sizeof(DfaRun), size)) {
+        return false;
+    }
+
+    // a corrupt file must not send the scanner outside the table
+    const uint8_t * classMap = (const uint8_t *)(data + header->m_classMapOffset);
+    for (int c = 0; c < 256; ++c) {
+        if (classMap[c] >= classCount) {
+            return false;
+        }
+    }
+    const uint16_t * next = (const uint16_t *)(data + header->m_nextOffset);
+    for (size_t i = 0; i < rowCount * classCount; ++i) {
+        if ((next[i] & STATE_MASK) >= rowCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//=========================================================
+// Runs of a mapped table are not taken from the file, a crafted run could
+// skip the NUL a terminated scan stops on. They are found again from the
+// rows, and the flags of every entry must agree with them.
+static bool InternalRebuildRuns (DfaTable * table) {
+    size_t rowCount = table->m_rowCount;
+    size_t classCount = table->m_classCount;
+    table->m_runStorage.assign(rowCount, DfaRun());
+
+    uint16_t next[256];
+    for (size_t row = 1; row < rowCount; ++row) {
+        for (int c = 0; c < 256; ++c) {
+            next[c] = table->m_next[row * classCount + table->m_classMap[c]];
+        }
+        table->m_runStorage[row] = InternalRowRun(next, row);
+    }
+
+    for (size_t i = 0; i < rowCount * classCount; ++i) {
+        uint16_t entry = table->m_next[i];
+        uint16_t target = entry & STATE_MASK;
+        bool accepting = target != DEAD_STATE && table->m_tokenType[target] != NOT_ACCEPTING;
+        if (((entry & RUN_BIT) != 0) != (table->m_runStorage[target].m_byteCount != 0) ||
+            ((entry & ACCEPTING_BIT) != 0) != accepting) {
+            return false;
+        }
+    }
+    table->m_runs = table->m_runStorage.data();
+    return true;
+}
+
+//=========================================================
+// distinct (state, target) pairs, the table form of a DfaEdge
+static int InternalCountEdges (const DfaTable * table) {
+    size_t rowCount = table->m_rowCount;
+    std::vector<size_t> seenInRow(rowCount, 0);
+    int edges = 0;
+    for (size_t row = 1; row < rowCount; ++row) {
+        for (size_t k = 0; k < table->m_classCount; ++k) {
+            uint16_t target = table->m_next[row * table->m_classCount + k] & STATE_MASK;
+            if (target != DEAD_STATE && seenInRow[target] != row) {
+                seenInRow[target] = row;
+                ++edges;
+            }
+        }
+    }
+    return edges;
+}
+
+//=========================================================
+// Hopcroft partition refinement. Rows start split by accepting token and
+// by m_spansToEnd with the dead row on its own, so merged rows also stop on
+// the same byte and end input the same way.
+// Refines per byte class rather than per byte, bytes in a class already
+// behave the same. Returns the block of every row, block 0 holds the dead
+// row.
+static std::vector<int> InternalPartitionRows (const DfaTable * table, int & outBlockCount) {
+    int rowCount = table->m_rowCount;
+    int classCount = table->m_classCount;
+
+    // predecessors of every row per class, the sources of (target, k) are
+    // inverse[inverseStart[target * classCount + k], inverseStart[... + 1])
+    size_t cellCount = (size_t)rowCount * classCount;
+    std::vector<int> inverseStart(cellCount + 1, 0);
+    std::vector<int> inverse(cellCount);
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        int k = (int)(cell % classCount);
+        ++inverseStart[(table->m_next[cell] & STATE_MASK) * classCount + k + 1];
+    }
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        inverseStart[cell + 1] += inverseStart[cell];
+    }
+    std::vector<int> inverseFill(inverseStart.begin(), inverseStart.end() - 1);
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        int row = (int)(cell / classCount);
+        int k = (int)(cell % classCount);
+        inverse[inverseFill[(table->m_next[cell] & STATE_MASK) * classCount + k]++] = row;
+    }
+
+    std::vector<int> blockOf(rowCount);
+    std::vector<std::vector<int>> blocks(1, std::vector<int>(1, DEAD_STATE));
+    std::map<uint32_t, int> blockOfToken;
+    for (int row = 1; row < rowCount; ++row) {
+        uint32_t key = table->m_tokenType[row] | (table->m_spansToEnd[row] ? 0x10000u : 0);
+        auto found = blockOfToken.find(key);
+        if (found == blockOfToken.end()) {
+            found = blockOfToken.insert(std::make_pair(key, (int)blocks.size())).first;
+            blocks.push_back(std::vector<int>());
+        }
+        blockOf[row] = found->second;
+        blocks[found->second].push_back(row);
+    }
+
+    std::vector<int> worklist;
+    std::vector<bool> inWorklist(blocks.size(), true);
+    for (int block = 0; block < (int)blocks.size(); ++block) {
+        worklist.push_back(block);
+    }
+
+    std::vector<int> marked(rowCount, 0);
+    int mark = 0;
+    while (!worklist.empty()) {
+        int splitter = worklist.back();
+        worklist.pop_back();
+        inWorklist[splitter] = false;
+        std::vector<int> splitterRows = blocks[splitter];
+
+        for (int k = 0; k < classCount; ++k) {
+            // rows that reach the splitter on class k
+            ++mark;
+            std::vector<int> touchedBlocks;
+            for (int row : splitterRows) {
+                for (int i = inverseStart[row * classCount + k]; i < inverseStart[row * classCount + k + 1]; ++i) {
+                    int source = inverse[i];
+                    if (marked[source] != mark) {
+                        marked[source] = mark;
+                        touchedBlocks.push_back(blockOf[source]);
+                    }
+                }
+            }
+            std::sort(touchedBlocks.begin(), touchedBlocks.end());
+            touchedBlocks.erase(std::unique(touchedBlocks.begin(), touchedBlocks.end()), touchedBlocks.end());
+
+            for (int block : touchedBlocks) {
+                std::vector<int> inside;
+                std::vector<int> outside;
+                for (int row : blocks[block]) {
+                    (marked[row] == mark ? inside : outside).push_back(row);
+                }
+                if (outside.empty()) {
+                    continue;
+                }
+
+                int newBlock = (int)blocks.size();
+                blocks[block].swap(inside);
+                blocks.push_back(outside);
+                for (int row : blocks[newBlock]) {
+                    blockOf[row] = newBlock;
+                }
+
+                // a queued block must be processed in both halves, otherwise
+                // the smaller half is enough
+                inWorklist.push_back(false);
+                if (inWorklist[block] || blocks[newBlock].size() < blocks[block].size()) {
+                    worklist.push_back(newBlock);
+                    inWorklist[newBlock] = true;
+                }
+                else {
+                    worklist.push_back(block);
+                    inWorklist[block] = true;
+                }
+            }
+        }
+    }
+
+    outBlockCount = (int)blocks.size();
+    return blockOf;
+}
+
+//=========================================================
+// DfaContext
+//
+
+//=========================================================
+DfaContext::DfaContext ()
+{}
+
+//=========================================================
+DfaContext::~DfaContext ()
+{}
+
+#if !defined(NDEBUG)
+//=========================================================
+// Regression check of the end of input rules for user graphs, which back
+// off at the end of input like anywhere else. With a and a a* b, "aaa" is
+// three a tokens on the graph and on its table, not one unfinished "aaa".
+static bool InternalBacksOffAtEnd () {
+    DfaContext context;
+    DfaState * root = context.AddState(NOT_ACCEPTING);
+    DfaState * a = context.AddState(1);
+    DfaState * as = context.AddState(NOT_ACCEPTING);
+    DfaState * ab = context.AddState(2);
+    context.AddEdge(root, a, 'a');
+    context.AddEdge(a, as, 'a');
+    context.AddEdge(as, as, 'a');
+    context.AddEdge(a, ab, 'b');
+    context.AddEdge(as, ab, 'b');
+
+    Token token;
+    InternalReadToken(root, "aaa", token);
+    bool backsOff = token.mTokenType == 1 && token.mLength == 1;
+
+    context.FreezeDfa(root);
+    InternalReadToken(root, "aaa", token);
+    backsOff &= token.mTokenType == 1 && token.mLength == 1;
+
+    std::vector<Token> tokens;
+    TokenizeAll(root, "aaa", 3, tokens);
+    for (const Token & frozen : tokens) {
+        backsOff &= frozen.mTokenType == 1 && frozen.mLength == 1;
+    }
+    return backsOff && tokens.size() == 3;
+}
+#endif
+
+//=========================================================
+DfaContext & DfaContext::Default () {
+    static DfaContext context;
+#if !defined(NDEBUG)
+    static bool backsOff = InternalBacksOffAtEnd();
+    assert(backsOff);
+#endif
+    return context;
+}
+
+//=========================================================
+DfaState * DfaContext::AddState (int acceptingToken) {
+    DfaState * state = m_states.Allocate();
+    state->m_accepting = acceptingToken != NOT_ACCEPTING;
+    state->m_tokenType = acceptingToken;
+
+    return state;
+}
+
+//=========================================================
+void DfaContext::AddEdge (DfaState * from, DfaState * to, char c) {
+    assert(from && to && c != DEFAULT_EDGE_CONDITION);
+    InternalAddEdge(from, to, c, nullptr);
+}
+
+//=========================================================
+void DfaContext::AddDefaultEdge (DfaState * from, DfaState * to) {
+    assert(from && to);
+    InternalAddEdge(from, to, DEFAULT_EDGE_CONDITION, nullptr);
+}
+
+//=========================================================
+void DfaContext::DeleteStateAndChildren (DfaState * root) {
+    // states and edges are handed out zeroed, rewinding is enough
+    assert(root == m_states.First());
+    m_states.Reset();
+    m_edges.Reset();
+    m_tables.clear();
+}
+
+//=========================================================
+void DfaContext::GetArenaStats (DfaArenaStats & stats) const {
+    stats.m_states = m_states.Count();
+    stats.m_peakStates = m_states.Peak();
+    stats.m_edges = m_edges.Count();
+    stats.m_peakEdges = m_edges.Peak();
+    stats.m_reservedBytes = m_states.Capacity() * sizeof(DfaState) + m_edges.Capacity() * sizeof(DfaEdge);
+}
+
+//=========================================================
+void DfaContext::FreezeDfa (DfaState * root) {
+    assert(root && !root->m_table);
+    std::unique_ptr<DfaTable> table(new DfaTable);
+
+    // number every reachable state breadth first, the root gets row 1
+    std::vector<DfaState *> order;
+    InternalFreezeState(root, order);
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (DfaEdge * edge = order[i]->m_edge; edge; edge = edge->m_nextSibling) {
+            InternalFreezeState(edge->m_state, order);
+        }
+        if (order[i]->m_defaultEdge) {
+            InternalFreezeState(order[i]->m_defaultEdge->m_state, order);
+        }
+    }
+
+    table->m_nextStorage.assign((order.size() + 1) << 8, DEAD_STATE);
+    table->m_tokenTypeStorage.assign(order.size() + 1, NOT_ACCEPTING);
+    table->m_spansToEndStorage.assign(order.size() + 1, 0);
+    for (DfaState * state : order) {
+        uint16_t * row = &table->m_nextStorage[state->m_tableIndex << 8];
+        if (state->m_accepting) {
+            table->m_tokenTypeStorage[state->m_tableIndex] = (uint16_t)state->m_tokenType;
+        }
+        table->m_spansToEndStorage[state->m_tableIndex] = state->m_spansToEnd;
+
+        // first matching sibling wins, the default edge takes everything else
+        for (int c = 0; c < 256; ++c) {
+            DfaState * target = nullptr;
+            for (DfaEdge * edge = state->m_edge; edge; edge = edge->m_nextSibling) {
+                if (edge->m_condition(edge, (char)c)) {
+                    target = edge->m_state;
+                    break;
+                }
+            }
+            if (!target && state->m_defaultEdge) {
+                target = state->m_defaultEdge->m_state;
+            }
+            if (target) {
+                row[c] = target->m_tableIndex | (target->m_accepting ? ACCEPTING_BIT : 0);
+            }
+        }
+    }
+
+    InternalFinishTable(table.get());
+
+    for (DfaState * state : order) {
+        state->m_table = table.get();
+    }
+    m_tables.push_back(std::move(table));
+}
+
+//=========================================================
+void DfaContext::MinimizeDfa (DfaState * root, DfaMinimizeStats * stats) {
+    if (!root->m_table) {
+        FreezeDfa(root);
+    }
+    const DfaTable * table = root->m_table;
+    int rowCount = table->m_rowCount;
+
+    int blockCount;
+    std::vector<int> blockOf = InternalPartitionRows(table, blockCount);
+
+    // blocks keep the order of their first row so the root stays near the top
+    std::vector<int> rowOfBlock(blockCount, -1);
+    int newRowCount = 0;
+    for (int row = 0; row < rowCount; ++row) {
+        if (rowOfBlock[blockOf[row]] < 0) {
+            rowOfBlock[blockOf[row]] = newRowCount++;
+        }
+    }
+
+    std::unique_ptr<DfaTable> minimized(new DfaTable);
+    minimized->m_nextStorage.assign((size_t)newRowCount << 8, DEAD_STATE);
+    minimized->m_tokenTypeStorage.assign(newRowCount, NOT_ACCEPTING);
+    minimized->m_spansToEndStorage.assign(newRowCount, 0);
+    for (int row = 0; row < rowCount; ++row) {
+        int newRow = rowOfBlock[blockOf[row]];
+        minimized->m_tokenTypeStorage[newRow] = table->m_tokenType[row];
+        minimized->m_spansToEndStorage[newRow] = table->m_spansToEnd[row];
+        for (int c = 0; c < 256; ++c) {
+            uint16_t oldTarget = InternalEntry(table, row, (unsigned char)c) & STATE_MASK;
+            uint16_t target = (uint16_t)rowOfBlock[blockOf[oldTarget]];
+            bool accepting = target != DEAD_STATE && table->m_tokenType[oldTarget] != NOT_ACCEPTING;
+            minimized->m_nextStorage[(newRow << 8) | c] = target | (accepting ? ACCEPTING_BIT : 0);
+        }
+    }
+    InternalFinishTable(minimized.get());
+
+    if (stats) {
+        stats->m_statesBefore = rowCount - 1;
+        stats->m_statesAfter = newRowCount - 1;
+        stats->m_edgesBefore = InternalCountEdges(table);
+        stats->m_edgesAfter = InternalCountEdges(minimized.get());
+    }
+
+    // point the graph at the merged rows
+    m_states.ForEach([&](DfaState * state) {
+        if (state->m_table == table) {
+            state->m_table = minimized.get();
+            state->m_tableIndex = (uint16_t)rowOfBlock[blockOf[state->m_tableIndex]];
+        }
+    });
+    for (std::unique_ptr<DfaTable> & owned : m_tables) {
+        if (owned.get() == table) {
+            owned = std::move(minimized);
+            break;
+        }
+    }
+}
+
+//=========================================================
+void DfaContext::ReorderDfa (DfaState * root, const std::vector<uint16_t> & order) {
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    int rowCount = table->m_rowCount;
+
+    // the dead row stays at zero
+    std::vector<int> newRowOf(rowCount, -1);
+    newRowOf[DEAD_STATE] = DEAD_STATE;
+    int newRowCount = 1;
+    for (uint16_t row : order) {
+        assert(row < rowCount && row != DEAD_STATE && newRowOf[row] < 0);
+        newRowOf[row] = newRowCount++;
+    }
+    for (int row = 1; row < rowCount; ++row) {
+        if (newRowOf[row] < 0) {
+            newRowOf[row] = newRowCount++;
+        }
+    }
+
+    std::unique_ptr<DfaTable> reordered(new DfaTable);
+    reordered->m_nextStorage.assign((size_t)rowCount << 8, DEAD_STATE);
+    reordered->m_tokenTypeStorage.assign(rowCount, NOT_ACCEPTING);
+    reordered->m_spansToEndStorage.assign(rowCount, 0);
+    for (int row = 1; row < rowCount; ++row) {
+        int newRow = newRowOf[row];
+        reordered->m_tokenTypeStorage[newRow] = table->m_tokenType[row];
+        reordered->m_spansToEndStorage[newRow] = table->m_spansToEnd[row];
+        for (int c = 0; c < 256; ++c) {
+            uint16_t entry = InternalEntry(table, row, (unsigned char)c);
+            reordered->m_nextStorage[(newRow << 8) | c] = (uint16_t)newRowOf[entry & STATE_MASK] | (entry & ACCEPTING_BIT);
+        }
+    }
+    InternalFinishTable(reordered.get());
+
+    m_states.ForEach([&](DfaState * state) {
+        if (state->m_table == table) {
+            state->m_table = reordered.get();
+            state->m_tableIndex = (uint16_t)newRowOf[state->m_tableIndex];
+        }
+    });
+    for (std::unique_ptr<DfaTable> & owned : m_tables) {
+        if (owned.get() == table) {
+            owned = std::move(reordered);
+            break;
+        }
+    }
+}
+
+//=========================================================
+DfaState * DfaContext::LoadDfa (const char * path) {
+    std::unique_ptr<DfaTable> table(new DfaTable);
+    table->m_source.reset(new MappedSource);
+    if (!table->m_source->Open(path)) {
+        return nullptr;
+    }
+    const char * data = table->m_source->Data();
+    if (!InternalValidateTable(data, table->m_source->Size())) {
+        return nullptr;
+    }
+
+    const DfaFileHeader * header = (const DfaFileHeader *)data;
+    table->m_next = (const uint16_t *)(data + header->m_nextOffset);
+    table->m_tokenType = (const uint16_t *)(data + header->m_tokenTypeOffset);
+    table->m_spansToEnd = (const uint8_t *)(data + header->m_spansToEndOffset);
+    table->m_classMap = (const uint8_t *)(data + header->m_classMapOffset);
+    table->m_rowCount = (uint16_t)header->m_rowCount;
+    table->m_classCount = (uint16_t)header->m_classCount;
+    table->m_skipRun = InternalSelectRunSkipper();
+    if (!InternalRebuildRuns(table.get())) {
+        return nullptr;
+    }
+
+    // the root has no edges of its own, it only names its row
+    DfaState * root = AddState(table->m_tokenType[header->m_rootRow]);
+    root->m_table = table.get();
+    root->m_tableIndex = (uint16_t)header->m_rootRow;
+    m_tables.push_back(std::move(table));
+    return root;
+}
+
+//=========================================================
+// Public Methods
+//
+
+//=========================================================
+DfaState * AddState (int acceptingToken) {
+    return DfaContext::Default().AddState(acceptingToken);
+}
+
+//=========================================================
+void AddEdge (DfaState * from, DfaState * to, char c) {
+    DfaContext::Default().AddEdge(from, to, c);
+}
+
+//=========================================================
+void AddDefaultEdge (DfaState * from, DfaState * to) {
+    DfaContext::Default().AddDefaultEdge(from, to);
+}
+
+//=========================================================
+void ReadToken(DfaState * startingState, const char * stream, Token & outToken) {
+    InternalReadToken(startingState, stream, outToken);
+}
+
+//=========================================================
+void DeleteStateAndChildren (DfaState * root) {
+    // CreateLanguageDfa hands out the static table, no context owns it
+    if (root == StaticLanguageDfa()) {
+        return;
+    }
+    DfaContext::Default().DeleteStateAndChildren(root);
+}
+
+//=========================================================
+void FreezeDfa (DfaState * root) {
+    DfaContext::Default().FreezeDfa(root);
+}
+
+//=========================================================
+void MinimizeDfa (DfaState * root, DfaMinimizeStats * stats) {
+    DfaContext::Default().MinimizeDfa(root, stats);
+}
+
+//=========================================================
+void ReorderDfa (DfaState * root, const std::vector<uint16_t> & order) {
+    DfaContext::Default().ReorderDfa(root, order);
+}
+
+//=========================================================
+void ProfileDfa (DfaState * root, const char * data, size_t length, std::vector<uint16_t> & outOrder) {
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    const uint16_t rootIndex = root->m_tableIndex;
+
+    // each token is walked again to count the rows it went through,
+    // lookahead past the token is not counted
+    std::vector<uint64_t> visits(table->m_rowCount, 0);
+    const char * curr = data;
+    const char * end = data + length;
+    while (curr != end) {
+        unsigned int tokenType;
+        size_t tokenLength = std::max<size_t>(InternalScanFrozen<false>(table, rootIndex, curr, end, tokenType), 1);
+        uint16_t state = rootIndex;
+        for (size_t i = 0; i < tokenLength && state != DEAD_STATE; ++i) {
+            ++visits[state];
+            state = InternalEntry(table, state, (unsigned char)curr[i]) & STATE_MASK;
+        }
+        curr += tokenLength;
+    }
+
+    outOrder.clear();
+    for (uint16_t row = 1; row < table->m_rowCount; ++row) {
+        outOrder.push_back(row);
+    }
+    std::stable_sort(outOrder.begin(), outOrder.end(), [&](uint16_t a, uint16_t b) {
+        return visits[a] > visits[b];
+    });
+}
+
+//=========================================================
+bool SaveDfa (DfaState * root, const char * path) {
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    size_t rowCount = table->m_rowCount;
+    size_t classCount = table->m_classCount;
+
+    DfaFileHeader header = {};
+    header.m_magic = DFA_FILE_MAGIC;
+    header.m_version = DFA_FILE_VERSION;
+    header.m_byteOrder = DFA_FILE_BYTE_ORDER;
+    header.m_rowCount = (uint32_t)rowCount;
+    header.m_classCount = (uint32_t)classCount;
+    header.m_rootRow = root->m_tableIndex;
+    header.m_classMapOffset = InternalAlignOffset(sizeof(header));
+    header.m_nextOffset = InternalAlignOffset(header.m_classMapOffset + 256);
+    header.m_tokenTypeOffset = InternalAlignOffset(header.m_nextOffset + rowCount * classCount * sizeof(uint16_t));
+    header.m_spansToEndOffset = InternalAlignOffset(header.m_tokenTypeOffset + rowCount * sizeof(uint16_t));
+    header.m_runsOffset = InternalAlignOffset(header.m_spansToEndOffset + rowCount);
+    header.m_fileSize = header.m_runsOffset + (uint32_t)(rowCount * sizeof(DfaRun));
+
+    std::string image(header.m_fileSize, '\0');
+    memcpy(&image[0], &header, sizeof(header));
+    memcpy(&image[header.m_classMapOffset], table->m_classMap, 256);
+    memcpy(&image[header.m_nextOffset], table->m_next, rowCount * classCount * sizeof(uint16_t));
+    memcpy(&image[header.m_tokenTypeOffset], table->m_tokenType, rowCount * sizeof(uint16_t));
+    memcpy(&image[header.m_spansToEndOffset], table->m_spansToEnd, rowCount);
+    memcpy(&image[header.m_runsOffset], table->m_runs, rowCount * sizeof(DfaRun));
+
+    FILE * file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = fwrite(image.data(), 1, image.size(), file) == image.size();
+    return fclose(file) == 0 && written;
+}
+
+//=========================================================
+void GetDfaTableStats (const DfaState * root, DfaTableStats & stats) {
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    size_t rowCount = table->m_rowCount;
+    size_t rowBytes = rowCount * (sizeof(uint16_t) + sizeof(uint8_t) + sizeof(DfaRun));
+    stats.m_rows = (int)rowCount;
+    stats.m_byteClasses = table->m_classCount;
+    stats.m_tableBytes = rowBytes + rowCount * table->m_classCount * sizeof(uint16_t) + 256;
+    stats.m_uncompressedBytes = rowBytes + (rowCount << 8) * sizeof(uint16_t);
+}
+
+//=========================================================
+DfaState * LoadDfa (const char * path) {
+    return DfaContext::Default().LoadDfa(path);
+}
+
+//=========================================================
+// bytes of a row that share a target, longer spans are tested as a range
+struct ScannerRange {
+    unsigned m_first;
+    unsigned m_last;
+    uint16_t m_entry;
+};
+
+static const unsigned MIN_SCANNER_RANGE = 4;
+
+//=========================================================
+static void InternalAppendFormat (std::string & out, const char * format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    assert(length >= 0 && length < (int)sizeof(buffer));
+    out.append(buffer, length);
+}
+
+//=========================================================
+static void InternalAppendGoto (std::string & out, uint16_t entry) {
+    if (entry == DEAD_STATE) {
+        out += "goto dead;";
+    }
+    else {
+        InternalAppendFormat(out, "goto state%u;", entry & STATE_MASK);
+    }
+}
+
+//=========================================================
+static void InternalEmitScannerRow (const DfaTable * table, size_t row, std::string & out) {
+    InternalAppendFormat(out, "state%u:\n", (unsigned)row);
+    if (table->m_tokenType[row] != NOT_ACCEPTING) {
+        InternalAppendFormat(out, "    acceptingEnd = curr;\n    acceptingType = %u;\n", table->m_tokenType[row]);
+    }
+    // running out of input ends the token here unless this row backs off,
+    // same rules as InternalFinishWalk
+    if (InternalSpansToEnd(table, (uint16_t)row)) {
+        InternalAppendFormat(out,
+            "    if (curr == end) {\n"
+            "        outTokenType = %u;\n"
+            "        return end - stream;\n"
+            "    }\n",
+            InternalEndOfInputType(table, (uint16_t)row)
+        );
+    }
+    else {
+        out +=
+            "    if (curr == end) {\n"
+            "        outTokenType = acceptingEnd != stream ? acceptingType : 0;\n"
+            "        return (acceptingEnd != stream ? acceptingEnd : end) - stream;\n"
+            "    }\n";
+    }
+
+    // the target with the most bytes is the fall through, the rest are
+    // ranges or switch cases
+    std::vector<ScannerRange> ranges;
+    std::map<uint16_t, unsigned> byteCounts;
+    for (unsigned c = 0; c < 256; ++c) {
+        uint16_t entry = InternalEntry(table, row, (unsigned char)c);
+        ++byteCounts[entry];
+        if (!ranges.empty() && ranges.back().m_entry == entry) {
+            ranges.back().m_last = c;
+        }
+        else {
+            ranges.push_back(ScannerRange{ c, c, entry });
+        }
+    }
+    uint16_t fallThrough = DEAD_STATE;
+    unsigned mostBytes = 0;
+    for (const auto & count : byteCounts) {
+        if (count.second > mostBytes) {
+            fallThrough = count.first;
+            mostBytes = count.second;
+        }
+    }
+
+    out += "    c = (unsigned char)*curr++;\n";
+    bool anyCase = false;
+    for (const ScannerRange & range : ranges) {
+        if (range.m_entry == fallThrough || range.m_last - range.m_first + 1 < MIN_SCANNER_RANGE) {
+            anyCase |= range.m_entry != fallThrough;
+            continue;
+        }
+        InternalAppendFormat(out, "    if (c >= %u && c <= %u) ", range.m_first, range.m_last);
+        InternalAppendGoto(out, range.m_entry);
+        out += "\n";
+    }
+    if (anyCase) {
+        out += "    switch (c) {\n";
+        for (const ScannerRange & range : ranges) {
+            if (range.m_entry == fallThrough || range.m_last - range.m_first + 1 >= MIN_SCANNER_RANGE) {
+                continue;
+            }
+            for (unsigned c = range.m_first; c <= range.m_last; ++c) {
+                InternalAppendFormat(out, "        case %u: ", c);
+                InternalAppendGoto(out, range.m_entry);
+                out += "\n";
+            }
+        }
+        out += "    }\n";
+    }
+    out += "    ";
+    InternalAppendGoto(out, fallThrough);
+    out += "\n";
+}
+
+//=========================================================
+bool EmitScanner (DfaState * root, const char * functionName, const char * path) {
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+
+    // only rows reachable from root get a label, unused labels are warned on
+    std::vector<bool> reached(table->m_rowCount, false);
+    std::vector<uint16_t> pending(1, root->m_tableIndex);
+    reached[root->m_tableIndex] = true;
+    while (!pending.empty()) {
+        uint16_t row = pending.back();
+        pending.pop_back();
+        for (unsigned c = 0; c < 256; ++c) {
+            uint16_t target = InternalEntry(table, row, (unsigned char)c) & STATE_MASK;
+            if (target != DEAD_STATE && !reached[target]) {
+                reached[target] = true;
+                pending.push_back(target);
+            }
+        }
+    }
+
+    std::string source;
+    source +=
+        "// Generated by EmitScanner, do not edit.\n"
+        "#include <stddef.h>\n"
+        "\n";
+    InternalAppendFormat(source, "size_t %s (const char * stream, const char * end, unsigned int & outTokenType) {\n", functionName);
+    InternalAppendFormat(source,
+        "    const char * curr = stream;\n"
+        "    const char * acceptingEnd = stream;\n"
+        "    unsigned int acceptingType = 0;\n"
+        "    unsigned char c;\n"
+        "    goto state%u;\n"
+        "\n",
+        root->m_tableIndex
+    );
+    for (size_t row = 1; row < table->m_rowCount; ++row) {
+        if (reached[row]) {
+            InternalEmitScannerRow(table, row, source);
+            source += "\n";
+        }
+    }
+    // same length rules as InternalFinishWalk, curr is one past the byte
+    // that had no transition
+    source +=
+        "dead:\n"
+        "    --curr;\n"
+        "    outTokenType = acceptingType;\n"
+        "    return (acceptingEnd != stream ? acceptingEnd : curr) - stream;\n"
+        "}\n";
+
+    FILE * file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = fwrite(source.data(), 1, source.size(), file) == source.size();
+    return fclose(file) == 0 && written;
+}
+
+//=========================================================
+void BenchmarkScanner (
+    ScannerFunction scanner,
+    DfaState * root,
+    const char * data,
+    size_t length,
+    ScannerBenchmarkStats & stats
+) {
+    assert(root->m_table && data[length] == '\0');
+
+    std::vector<Token> scanned;
+    scanned.reserve(length / 4 + 1);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const char * end = data + length;
+    for (const char * curr = data; curr != end; curr += scanned.back().mLength) {
+        unsigned int tokenType;
+        size_t tokenLength = scanner(curr, end, tokenType);
+        scanned.push_back(InternalMakeToken(curr, tokenLength, tokenType));
+    }
+    InternalFillStats(&stats.m_scanner, length, scanned.size(), start);
+
+    std::vector<Token> tabled;
+    TokenizeAll(root, data, length, tabled, &stats.m_table);
+
+    std::vector<Token> read;
+    read.reserve(length / 4 + 1);
+    start = std::chrono::steady_clock::now();
+    for (const char * curr = data; curr != end; curr += read.back().mLength) {
+        Token token;
+        ReadLanguageToken(root, curr, token);
+        read.push_back(InternalMakeToken(token.mText, token.mLength, token.mTokenType));
+    }
+    InternalFillStats(&stats.m_readToken, length, read.size(), start);
+
+    auto same = [](const Token & a, const Token & b) {
+        return a.mText == b.mText && a.mLength == b.mLength && a.mTokenType == b.mTokenType;
+    };
+    stats.m_identical =
+        scanned.size() == tabled.size() && read.size() == tabled.size() &&
+        std::equal(scanned.begin(), scanned.end(), tabled.begin(), same) &&
+        std::equal(read.begin(), read.end(), tabled.begin(), same);
+}
+
+//=========================================================
+// drops whitespace and comments, counting the bytes they cover
+struct InternalSignificantSink : InternalTokenSink {
+    InternalSignificantSink (std::vector<Token> & tokens, std::vector<uint32_t> * leadingTrivia, const char * data) :
+        m_tokens(tokens),
+        m_leadingTrivia(leadingTrivia),
+        m_first(tokens.size()),
+        m_triviaStart(data)
+    {}
+
+    // roughly every other token is trivia
+    void Reserve (size_t count) {
+        m_tokens.reserve(m_first + count / 2);
+        if (m_leadingTrivia) {
+            m_leadingTrivia->reserve(m_first + count / 2);
+        }
+    }
+
+    void Add (const Token & token) {
+        if (token.mTokenType == TokenType::Whitespace ||
+            token.mTokenType == TokenType::SingleLineComment ||
+            token.mTokenType == TokenType::MultiLineComment) {
+            return;
+        }
+        if (m_leadingTrivia) {
+            assert((size_t)(token.mText - m_triviaStart) <= UINT32_MAX);
+            m_leadingTrivia->push_back((uint32_t)(token.mText - m_triviaStart));
+        }
+        m_tokens.push_back(token);
+        m_triviaStart = token.mText + token.mLength;
+    }
+
+    size_t Count () const { return m_tokens.size() - m_first; }
+
+    std::vector<Token> & m_tokens;
+    std::vector<uint32_t> * m_leadingTrivia;
+    size_t m_first;
+    const char * m_triviaStart;
+};
+
+//=========================================================
+struct InternalAnnotatingSink : InternalVectorSink {
+    InternalAnnotatingSink (std::vector<Token> & tokens, const TokenAnnotations & annotations) :
+        InternalVectorSink(tokens),
+        m_annotations(annotations)
+    {}
+
+    void Reserve (size_t count) {
+        InternalVectorSink::Reserve(count);
+        if (m_annotations.m_symbolIds) {
+            m_annotations.m_symbolIds->reserve(m_first + count);
+        }
+    }
+
+    void Add (const Token & token) {
+        InternalVectorSink::Add(token);
+        if (m_annotations.m_symbols) {
+            uint32_t symbol = token.mTokenType == TokenType::Identifier ?
+                m_annotations.m_symbols->Intern(token.mText, token.mLength) :
+                SymbolTable::INVALID_SYMBOL;
+            if (m_annotations.m_symbolIds) {
+                m_annotations.m_symbolIds->push_back(symbol);
+            }
+        }
+        if (m_annotations.m_literals) {
+            m_annotations.m_literals->Add(token);
+        }
+    }
+
+    const TokenAnnotations & m_annotations;
+};
+
+//=========================================================
+struct InternalBatchSink : InternalVectorSink {
+    InternalBatchSink (std::vector<Token> & tokens, std::vector<TokenRange> & ranges) :
+        InternalVectorSink(tokens),
+        m_ranges(ranges)
+    {}
+
+    void StartInput (size_t index) { m_ranges[index].m_first = m_tokens.size(); }
+
+    std::vector<TokenRange> & m_ranges;
+};
+
+//=========================================================
+struct InternalStreamSink : InternalTokenSink {
+    explicit InternalStreamSink (TokenStream & tokens) :
+        m_tokens(tokens)
+    {}
+
+    void Reserve (size_t count) { m_tokens.Reserve(count); }
+    void Add (const Token & token) { m_tokens.Push(token.mText, token.mLength, token.mTokenType); }
+    size_t Count () const { return m_tokens.Size(); }
+
+    TokenStream & m_tokens;
+};
+
+//=========================================================
+void TokenizeAll (DfaState * root, const char * data, size_t length, std::vector<Token> & tokens, LexerStats * stats) {
+    LexInput input = { data, length };
+    InternalVectorSink sink(tokens);
+    InternalTokenize(root, &input, 1, sink, stats);
+}
+
+//=========================================================
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    const TokenAnnotations & annotations,
+    LexerStats * stats
+) {
+    assert(!annotations.m_symbolIds || (annotations.m_symbols && annotations.m_symbolIds->size() == tokens.size()));
+    assert(!annotations.m_literals || annotations.m_literals->TokenCount() == tokens.size());
+    LexInput input = { data, length };
+    InternalAnnotatingSink sink(tokens, annotations);
+    InternalTokenize(root, &input, 1, sink, stats);
+}
+
+//=========================================================
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    SymbolTable & symbols,
+    std::vector<uint32_t> & symbolIds,
+    LexerStats * stats
+) {
+    TokenAnnotations annotations = { &symbols, &symbolIds, nullptr };
+    TokenizeAll(root, data, length, tokens, annotations, stats);
+}
+
+//=========================================================
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    LiteralValues & literals,
+    LexerStats * stats
+) {
+    TokenAnnotations annotations = { nullptr, nullptr, &literals };
+    TokenizeAll(root, data, length, tokens, annotations, stats);
+}
+
+//=========================================================
+void TokenizeBatch (
+    DfaState * root,
+    const LexInput * inputs,
+    size_t inputCount,
+    std::vector<Token> & tokens,
+    std::vector<TokenRange> & ranges,
+    LexerStats * stats
+) {
+    // Inputs are lexed one after the other straight into tokens. Walking
+    // several inputs in lockstep was tried and was slower: the table fits
+    // in L1, so there is little load latency to hide, and the walks are
+    // bound by the branch at each token end, which interleaving only adds
+    // bookkeeping to.
+    ranges.resize(inputCount);
+    InternalBatchSink sink(tokens, ranges);
+    InternalTokenize(root, inputs, inputCount, sink, stats);
+    for (size_t i = 0; i < inputCount; ++i) {
+        size_t next = i + 1 < inputCount ? ranges[i + 1].m_first : tokens.size();
+        ranges[i].m_count = next - ranges[i].m_first;
+    }
+}
+
+//=========================================================
+void TokenizeSignificant (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    std::vector<uint32_t> * leadingTrivia,
+    LexerStats * stats
+) {
+    assert(!leadingTrivia || leadingTrivia->size() == tokens.size());
+    LexInput input = { data, length };
+    InternalSignificantSink sink(tokens, leadingTrivia, data);
+    InternalTokenize(root, &input, 1, sink, stats);
+}
+
+//=========================================================
+void TokenizeAll (DfaState * root, const char * data, size_t length, TokenStream & tokens, LexerStats * stats) {
+    assert(length <= UINT32_MAX);
+    tokens.Reset(data);
+    LexInput input = { data, length };
+    InternalStreamSink sink(tokens);
+    InternalTokenize(root, &input, 1, sink, stats);
+}
+
+//=========================================================
+void TokenizeParallel (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    unsigned threadCount,
+    LexerStats * stats
+) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    assert(root->m_table);
+    const DfaTable * table = root->m_table;
+    const uint16_t rootIndex = root->m_tableIndex;
+    const char * end = data + length;
+
+    // chunks below this are not worth a thread
+    const size_t MIN_CHUNK_BYTES = 1 << 16;
+    // how far to look for a newline to cut at
+    const size_t SEAM_SEARCH_BYTES = 1 << 12;
+
+    if (!threadCount) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t chunkCount = std::min<size_t>(threadCount, length / MIN_CHUNK_BYTES);
+    if (chunkCount < 2) {
+        TokenizeAll(root, data, length, tokens, stats);
+        return;
+    }
+
+    // cut just past a newline where there is one, most tokens end there
+    std::vector<const char *> seams(chunkCount + 1);
+    seams[0] = data;
+    seams[chunkCount] = end;
+    for (size_t i = 1; i < chunkCount; ++i) {
+        const char * target = data + length / chunkCount * i;
+        const char * searchEnd = std::min(target + SEAM_SEARCH_BYTES, end);
+        const char * newline = std::find(target, searchEnd, '\n');
+        seams[i] = std::max(seams[i - 1], newline != searchEnd ? newline + 1 : target);
+    }
+
+    // every chunk is lexed as if a token started at its seam, tokens may
+    // run past the seam into the next chunk
+    std::vector<std::vector<Token>> chunkTokens(chunkCount);
+    std::vector<std::thread> threads;
+    threads.reserve(chunkCount - 1);
+    for (size_t i = 1; i < chunkCount; ++i) {
+        threads.emplace_back([&, i] {
+            InternalVectorSink sink(chunkTokens[i]);
+            sink.Reserve((seams[i + 1] - seams[i]) / 4 + 1);
+            InternalTokenizeRange(table, rootIndex, seams[i], seams[i + 1], end, sink);
+        });
+    }
+    InternalVectorSink sink(chunkTokens[0]);
+    sink.Reserve((seams[1] - seams[0]) / 4 + 1);
+    const char * curr = InternalTokenizeRange(table, rootIndex, seams[0], seams[1], end, sink);
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    // the first chunk is always right. A later one is only trusted from the
+    // first token starting where the sequential lex got to, before that it
+    // may have begun inside a comment or string and is lexed again here.
+    size_t firstToken = tokens.size();
+    tokens.reserve(firstToken + length / 4 + 1);
+    tokens.insert(tokens.end(), chunkTokens[0].begin(), chunkTokens[0].end());
+    for (size_t i = 1; i < chunkCount; ++i) {
+        const std::vector<Token> & speculative = chunkTokens[i];
+        std::vector<Token>::const_iterator next = speculative.begin();
+        while (curr < seams[i + 1]) {
+            while (next != speculative.end() && next->mText < curr) {
+                ++next;
+            }
+            if (next != speculative.end() && next->mText == curr) {
+                tokens.insert(tokens.end(), next, speculative.end());
+                curr = speculative.back().mText + speculative.back().mLength;
+                break;
+            }
+
+            unsigned int tokenType;
+            size_t tokenLength = InternalScanFrozen<false>(table, rootIndex, curr, end, tokenType);
+            tokens.push_back(InternalMakeToken(curr, tokenLength, tokenType));
+            curr += tokens.back().mLength;
+        }
+    }
+
+    InternalFillStats(stats, length, tokens.size() - firstToken, start);
+}
+
+//=========================================================
+bool TokenizeFile (DfaState * root, const char * path, MappedSource & source, std::vector<Token> & tokens, LexerStats * stats) {
+    if (!source.Open(path)) {
+        return false;
+    }
+    TokenizeAll(root, source.Data(), source.Size(), tokens, stats);
+    return true;
+}
+
+//=========================================================
+void ReadLanguageToken(DfaState * startingState, const char * stream, Token & outToken) {
+    InternalReadToken(startingState, stream, outToken);
+}
+
+//=========================================================
+void ReadLanguageToken (const char * stream, Token & outToken) {
+    ReadLanguageToken(StaticLanguageDfa(), stream, outToken);
+}
+
+//=========================================================
+DfaState* CreateLanguageDfa() {
+    return StaticLanguageDfa();
+}
+
+#if !defined(NDEBUG)
+//=========================================================
+// whether the generated table is still what CreateLanguageDfa builds, the
+// token list hash cannot see edits to CreateLanguageDfa itself
+static bool InternalIsCurrentLanguageTable (const DfaTable & table, uint16_t rootRow) {
+    DfaContext context;
+    DfaState * root = context.CreateLanguageDfa();
+    const DfaTable * built = root->m_table;
+    size_t rowCount = built->m_rowCount;
+    return root->m_tableIndex == rootRow &&
+           built->m_rowCount == table.m_rowCount &&
+           built->m_classCount == table.m_classCount &&
+           !memcmp(built->m_classMap, table.m_classMap, 256) &&
+           !memcmp(built->m_next, table.m_next, rowCount * built->m_classCount * sizeof(uint16_t)) &&
+           !memcmp(built->m_tokenType, table.m_tokenType, rowCount * sizeof(uint16_t)) &&
+           !memcmp(built->m_spansToEnd, table.m_spansToEnd, rowCount) &&
+           !memcmp(built->m_runs, table.m_runs, rowCount * sizeof(DfaRun));
+}
+#endif
+
+//=========================================================
+DfaState * StaticLanguageDfa () {
+    static DfaState * root = [] {
+        // token lists changed since LanguageTable.inl was generated, build
+        // the automaton once in a context that is never torn down
+        if (!LANGUAGE_TABLE_CURRENT) {
+            static DfaContext context;
+            return context.CreateLanguageDfa();
+        }
+
+        // only pointers are set up here, the rows were generated offline
+        static DfaTable table;
+        table.m_next = s_languageNext;
+        table.m_tokenType = s_languageTokenTypes;
+        table.m_spansToEnd = s_languageSpansToEnd;
+        table.m_runs = s_languageRuns;
+        table.m_classMap = s_languageClassMap;
+        table.m_rowCount = LANGUAGE_TABLE_ROWS;
+        table.m_classCount = LANGUAGE_TABLE_CLASSES;
+        table.m_skipRun = InternalSelectRunSkipper();
+        // debug builds catch a table left behind by a change to
+        // CreateLanguageDfa, regenerate it with EmitLanguageTable
+        assert(InternalIsCurrentLanguageTable(table, LANGUAGE_TABLE_ROOT));
+        static DfaState state = { nullptr, nullptr, NOT_ACCEPTING, false, false, &table, LANGUAGE_TABLE_ROOT };
+        return &state;
+    }();
+    return root;
+}
+
+//=========================================================
+// Name of a token type in the generated table. Every case is an enumerator
+// of the driver, so the table follows TokenType whatever its order.
+static const char * InternalTokenTypeName (unsigned tokenType) {
+    switch (tokenType) {
+        case TokenType::Whitespace:         return "TokenType::Whitespace";
+        case TokenType::Identifier:         return "TokenType::Identifier";
+        case TokenType::IntegerLiteral:     return "TokenType::IntegerLiteral";
+        case TokenType::FloatLiteral:       return "TokenType::FloatLiteral";
+        case TokenType::StringLiteral:      return "TokenType::StringLiteral";
+        case TokenType::CharacterLiteral:   return "TokenType::CharacterLiteral";
+        case TokenType::SingleLineComment:  return "TokenType::SingleLineComment";
+        case TokenType::MultiLineComment:   return "TokenType::MultiLineComment";
+        #define TOKEN(Name, Value) case TokenType::Name: return "TokenType::" #Name;
+        #include "../Drivers/TokenSymbols.inl"
+        #include "../Drivers/TokenKeywords.inl"
+        #undef TOKEN
+    }
+    return nullptr;
+}
+
+//=========================================================
+static bool InternalAppendTokenType (std::string & out, unsigned tokenType) {
+    const char * name = tokenType != NOT_ACCEPTING ? InternalTokenTypeName(tokenType) : "NOT_ACCEPTING";
+    if (!name) {
+        return false;
+    }
+    out += name;
+    return true;
+}
+
+//=========================================================
+bool EmitLanguageTable (const char * path) {
+    DfaContext context;
+    DfaState * root = context.CreateLanguageDfa();
+    const DfaTable * table = root->m_table;
+    size_t rowCount = table->m_rowCount;
+    size_t classCount = table->m_classCount;
+
+    std::string source;
+    source +=
+        "// Generated by EmitLanguageTable, do not edit. Regenerate it whenever\n"
+        "// CreateLanguageDfa or the driver token lists change.\n"
+        "\n";
+    InternalAppendFormat(source, "static const uint32_t LANGUAGE_TABLE_TOKEN_HASH = 0x%08x;\n", (unsigned)InternalHashTokenLists());
+    InternalAppendFormat(source, "static const uint16_t LANGUAGE_TABLE_ROOT = %u;\n", root->m_tableIndex);
+    InternalAppendFormat(source, "static const uint16_t LANGUAGE_TABLE_ROWS = %u;\n", (unsigned)rowCount);
+    InternalAppendFormat(source, "static const uint16_t LANGUAGE_TABLE_CLASSES = %u;\n", (unsigned)classCount);
+
+    source += "\nstatic const uint8_t s_languageClassMap[256] = {";
+    for (unsigned c = 0; c < 256; ++c) {
+        source += c % 16 ? " " : "\n    ";
+        InternalAppendFormat(source, "%u,", table->m_classMap[c]);
+    }
+    source += "\n};\n";
+
+    source += "\nstatic const uint16_t s_languageNext[LANGUAGE_TABLE_ROWS * LANGUAGE_TABLE_CLASSES] = {\n";
+    for (size_t row = 0; row < rowCount; ++row) {
+        InternalAppendFormat(source, "    // row %u", (unsigned)row);
+        for (size_t k = 0; k < classCount; ++k) {
+            source += k % 12 ? " " : "\n    ";
+            InternalAppendFormat(source, "0x%04x,", table->m_next[row * classCount + k]);
+        }
+        source += "\n";
+    }
+    source += "};\n";
+
+    source += "\nstatic const uint16_t s_languageTokenTypes[LANGUAGE_TABLE_ROWS] = {\n";
+    for (size_t row = 0; row < rowCount; ++row) {
+        source += "    ";
+        if (!InternalAppendTokenType(source, table->m_tokenType[row])) {
+            return false;
+        }
+        source += ",\n";
+    }
+    source += "};\n";
+
+    source += "\nstatic const uint8_t s_languageSpansToEnd[LANGUAGE_TABLE_ROWS] = {";
+    for (size_t row = 0; row < rowCount; ++row) {
+        source += row % 16 ? " " : "\n    ";
+        InternalAppendFormat(source, "%u,", table->m_spansToEnd[row]);
+    }
+    source += "\n};\n";
+
+    source += "\nstatic const DfaRun s_languageRuns[LANGUAGE_TABLE_ROWS] = {\n";
+    for (size_t row = 0; row < rowCount; ++row) {
+        const DfaRun & run = table->m_runs[row];
+        source += "    { {";
+        for (int i = 0; i < MAX_RUN_BYTES; ++i) {
+            InternalAppendFormat(source, " %u,", run.m_bytes[i]);
+        }
+        InternalAppendFormat(source, " }, %u, %s },\n", run.m_byteCount, run.m_stay ? "true" : "false");
+    }
+    source += "};\n";
+
+    FILE * file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = fwrite(source.data(), 1, source.size(), file) == source.size();
+    return fclose(file) == 0 && written;
+}
+
+//=========================================================
+DfaState * DfaContext::CreateLanguageDfa () {
+    DfaState * root = AddState(NOT_ACCEPTING);
+
+    // store out symbol states
+    std::map<std::string, DfaState *> symbolStates;
+
+    // find max symbol size
+    unsigned maxLength = 0;
+    for (unsigned i = 0; i < SYMBOL_COUNT; ++i) {
+        unsigned length = (unsigned)strlen(s_tokenSymbols[i]);
+        if (length > maxLength) {
+            maxLength = length;
+        }
+    }
+
+    // create symbol dfa
+    for (unsigned tokenLength = 1; tokenLength <= maxLength; ++tokenLength) {
+        for (unsigned i = 0; i < SYMBOL_COUNT; ++i) {
+            const char * symbol = s_tokenSymbols[i];
+            if (strlen(symbol) == tokenLength) {
+                DfaState * newState = AddState(TokenType::SymbolStart + 1 + i);
+                std::string tokenBuffer(symbol);
+                if (tokenBuffer.size() > 1) {
+                    tokenBuffer.pop_back();
+                }
+                auto parentState = symbolStates.find(tokenBuffer);
+                char edgeChar = symbol[tokenLength - 1];
+                if (parentState != symbolStates.end()) {
+                    AddEdge(parentState->second, newState, edgeChar);
+                }
+                else {
+                    AddEdge(root, newState, *symbol);
+                }
+                symbolStates[symbol] = newState;
+            }
+        }
+    }
+
+    DfaState * whiteSpace = AddState(TokenType::Whitespace);
+    DfaState * identifier = AddState(TokenType::Identifier);
+    DfaState * integerLiteral = AddState(TokenType::IntegerLiteral);
+    DfaState * floatLiteral = AddState(TokenType::FloatLiteral);
+    DfaState * stringLiteral = AddState(TokenType::StringLiteral);
+    DfaState * charLiteral = AddState(TokenType::CharacterLiteral);
+    DfaState * multiComment = AddState(TokenType::MultiLineComment);
+    DfaState * singleComment = AddState(TokenType::SingleLineComment);
+
+    // integer
+    InternalAddEdge(root, integerLiteral, 0, IntegerEdgeCondition);
+    InternalAddEdge(integerLiteral, integerLiteral, 0, IntegerEdgeCondition);
+
+    // float
+    DfaState * floatDot = AddState(NOT_ACCEPTING);
+    InternalAddEdge(integerLiteral, floatDot, '.', nullptr);
+    InternalAddEdge(floatDot, floatLiteral, 0, IntegerEdgeCondition);
+    InternalAddEdge(floatLiteral, floatLiteral, 0, IntegerEdgeCondition);
+    InternalAddEdge(floatLiteral, floatLiteral, 'e', nullptr);
+    InternalAddEdge(floatLiteral, floatLiteral, '+', nullptr);
+    InternalAddEdge(floatLiteral, floatLiteral, '-', nullptr);
+    DfaState * floatLiteralEnd = AddState(TokenType::FloatLiteral);
+    InternalAddEdge(floatLiteral, floatLiteralEnd, 'f', nullptr);
+
+    // string literal
+    DfaState * stringLiteralStart = AddState(NOT_ACCEPTING);
+    InternalAddEdge(root, stringLiteralStart, '"', nullptr);
+    InternalAddEdge(stringLiteralStart, stringLiteral, '"', nullptr);
+    DfaState * slEscaped = AddState(NOT_ACCEPTING);
+    InternalAddEdge(stringLiteralStart, slEscaped, '\\', nullptr);
+    InternalAddEdge(slEscaped, stringLiteralStart, 0, EscapedCharEdgeCondition);
+    AddDefaultEdge(stringLiteralStart, stringLiteralStart);
+
+    // char literal
+    DfaState * charLiteralStart = AddState(NOT_ACCEPTING);
+    InternalAddEdge(root, charLiteralStart, '\'', nullptr);
+    InternalAddEdge(charLiteralStart, charLiteral, '\'', nullptr);
+    DfaState * clEscaped = AddState(NOT_ACCEPTING);
+    InternalAddEdge(charLiteralStart, clEscaped, '\\', nullptr);
+    InternalAddEdge(clEscaped, charLiteralStart, 0, EscapedCharEdgeCondition);
+    AddDefaultEdge(charLiteralStart, charLiteralStart);
+
+    // multiline comment
+    DfaState * divisionState = symbolStates[s_tokenSymbols[TokenType::Divide - TokenType::SymbolStart - 1]];
+    DfaState * mlcStart = AddState(NOT_ACCEPTING);
+    DfaState * mlcStarFinder = AddState(NOT_ACCEPTING);
+    InternalAddEdge(divisionState, mlcStart, '*', nullptr);
+    InternalAddEdge(mlcStart, mlcStarFinder, '*', nullptr);
+    InternalAddEdge(mlcStarFinder, multiComment, '/', nullptr);
+    AddDefaultEdge(mlcStarFinder, mlcStart);
+    AddDefaultEdge(mlcStart, mlcStart);
+
+    // singleline comment
+    DfaState * slcStart = AddState(NOT_ACCEPTING);
+    InternalAddEdge(divisionState, slcStart, '/', nullptr);
+    InternalAddEdge(slcStart, singleComment, 0, EndOfLineEdgeCondition);
+    AddDefaultEdge(slcStart, slcStart);
+
+    // input that runs out in a comment or string is one token to the end
+    DfaState * bodies[] = {
+        stringLiteralStart, slEscaped, charLiteralStart, clEscaped, mlcStart, mlcStarFinder, slcStart
+    };
+    for (DfaState * body : bodies) {
+        body->m_spansToEnd = true;
+    }
+
+    // whitespace
+    InternalAddEdge(root, whiteSpace, 0, WhiteSpaceEdgeCondition);
+    InternalAddEdge(whiteSpace, whiteSpace, 0, WhiteSpaceEdgeCondition);
+
+    // keywords, a trie in front of the identifier edges. Each prefix is an
+    // identifier until it spells a whole keyword and any identifier
+    // character off the trie falls back to the identifier state.
+    std::map<std::string, DfaState *> keywordStates;
+    for (unsigned i = 0; i < KEYWORD_COUNT; ++i) {
+        std::string prefix;
+        DfaState * parentState = root;
+        for (const char * c = s_tokenKeywords[i]; *c; ++c) {
+            prefix.push_back(*c);
+            DfaState *& prefixState = keywordStates[prefix];
+            if (!prefixState) {
+                prefixState = AddState(TokenType::Identifier);
+                AddEdge(parentState, prefixState, *c);
+            }
+            parentState = prefixState;
+        }
+        parentState->m_tokenType = TokenType::KeywordStart + 1 + i;
+    }
+    for (auto & keywordState : keywordStates) {
+        InternalAddEdge(keywordState.second, identifier, 0, AlphaEdgeCondition);
+        InternalAddEdge(keywordState.second, identifier, '_', nullptr);
+        InternalAddEdge(keywordState.second, identifier, 0, IntegerEdgeCondition);
+    }
+
+    // identifier
+    InternalAddEdge(root, identifier, 0, AlphaEdgeCondition);
+    InternalAddEdge(root, identifier, '_', nullptr);
+
+    InternalAddEdge(identifier, identifier, 0, AlphaEdgeCondition);
+    InternalAddEdge(identifier, identifier, '_', nullptr);
+    InternalAddEdge(identifier, identifier, 0, IntegerEdgeCondition);
+
+    // every accepting state has a token type of its own, so minimizing
+    // would merge nothing and only cost startup time
+    FreezeDfa(root);
+    return root;
+}
+
+
+//=========================================================
+MappedSource::MappedSource () :
+    m_data(nullptr),
+    m_size(0)
+#if defined(_WIN32)
+    , m_file(INVALID_HANDLE_VALUE)
+    , m_mapping(nullptr)
+#endif
+{}
+
+//=========================================================
+MappedSource::~MappedSource () {
+    Close();
+}
+
+//=========================================================
+// the mapping is never written, pages are shared with the page cache and
+// faulted in as the lexer walks forward
+bool MappedSource::Open (const char * path) {
+    Close();
+#if defined(_WIN32)
+    m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size)) {
+        Close();
+        return false;
+    }
+    m_size = (size_t)size.QuadPart;
+    if (!m_size) {
+        m_data = "";
+        return true;
+    }
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping) {
+        m_data = (const char *)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) != 0) {
+        close(file);
+        return false;
+    }
+    m_size = (size_t)info.st_size;
+    if (!m_size) {
+        close(file);
+        m_data = "";
+        return true;
+    }
+    void * mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+    // the mapping holds its own reference to the file
+    close(file);
+    if (mapping != MAP_FAILED) {
+        madvise(mapping, m_size, MADV_SEQUENTIAL);
+        m_data = (const char *)mapping;
+    }
+#endif
+    if (!m_data) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+//=========================================================
+void MappedSource::Close () {
+#if defined(_WIN32)
+    if (m_data && m_size) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping) {
+        CloseHandle(m_mapping);
+    }
+    if (m_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_file);
+    }
+    m_mapping = nullptr;
+    m_file = INVALID_HANDLE_VALUE;
+#else
+    if (m_data && m_size) {
+        munmap((void *)m_data, m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+//=========================================================
+StreamingLexer::StreamingLexer (DfaState * root, TokenCallback callback) :
+    m_table(nullptr),
+    m_rootIndex(0),
+    m_state(0),
+    m_acceptingState(0),
+    m_acceptingLength(0),
+    m_callback(callback)
+{
+    assert(root->m_table);
+    m_table = root->m_table;
+    m_rootIndex = root->m_tableIndex;
+}
+
+//=========================================================
+void StreamingLexer::Feed (const char * data, size_t length) {
+    const char * curr = data;
+    const char * end = data + length;
+    while (curr != end) {
+        DfaCursor cursor;
+        if (m_carry.empty()) {
+            InternalStartCursor(m_table, m_rootIndex, curr, cursor);
+            const char * stop = InternalWalkFrozen<false>(m_table, cursor, curr, end);
+            if (stop != end || cursor.m_state == DEAD_STATE) {
+                // the whole token is in this chunk
+                size_t tokenLength = (cursor.m_acceptingEnd != curr ? cursor.m_acceptingEnd : stop) - curr;
+                Token token = InternalMakeToken(curr, tokenLength, m_table->m_tokenType[cursor.m_acceptingState]);
+                m_callback(token);
+                curr += token.mLength;
+                continue;
+            }
+
+            // ran out of input mid token, keep the lexeme for the next chunk
+            m_carry.assign(curr, end);
+            m_state = cursor.m_state;
+            m_acceptingState = cursor.m_acceptingState;
+            m_acceptingLength = cursor.m_acceptingEnd - curr;
+            return;
+        }
+
+        // pick the carried token up where the last chunk left it
+        cursor.m_state = m_state;
+        cursor.m_acceptingState = m_acceptingState;
+        cursor.m_acceptingEnd = nullptr;
+        const char * stop = InternalWalkFrozen<false>(m_table, cursor, curr, end);
+        if (cursor.m_acceptingEnd) {
+            m_acceptingState = cursor.m_acceptingState;
+            m_acceptingLength = m_carry.size() + (cursor.m_acceptingEnd - curr);
+        }
+        m_carry.append(curr, stop);
+        curr = stop;
+        if (stop == end && cursor.m_state != DEAD_STATE) {
+            m_state = cursor.m_state;
+            return;
+        }
+        FlushCarry();
+    }
+}
+
+//=========================================================
+void StreamingLexer::Finish () {
+    // input ended inside the carried token, it either spans to the end or
+    // backs off and the rest is lexed again, see InternalFinishWalk
+    while (!m_carry.empty()) {
+        if (!InternalSpansToEnd(m_table, m_state)) {
+            FlushCarry();
+            continue;
+        }
+        Token token = InternalMakeToken(m_carry.data(), m_carry.size(), InternalEndOfInputType(m_table, m_state));
+        m_callback(token);
+        m_carry.clear();
+    }
+}
+
+//=========================================================
+// emits the carried token and lexes whatever was read past its end again,
+// which can leave a shorter token carried
+void StreamingLexer::FlushCarry () {
+    size_t tokenLength = m_acceptingLength ? m_acceptingLength : m_carry.size();
+    Token token = InternalMakeToken(m_carry.data(), tokenLength, m_table->m_tokenType[m_acceptingState]);
+    m_callback(token);
+
+    std::string remainder(m_carry, token.mLength);
+    m_carry.clear();
+    Feed(remainder.data(), remainder.size());
+}
+
+//=========================================================
+IncrementalLexer::IncrementalLexer (DfaState * root) :
+    m_table(nullptr),
+    m_rootIndex(0),
+    m_maxLookahead(0)
+{
+    assert(root->m_table);
+    m_table = root->m_table;
+    m_rootIndex = root->m_tableIndex;
+}
+
+//=========================================================
+void IncrementalLexer::Reset (const char * text, size_t length) {
+    m_text.assign(text, length);
+    m_tokens.clear();
+    m_scanEnds.clear();
+    m_maxLookahead = 0;
+    LexFrom(0, m_text.size());
+}
+
+//=========================================================
+void IncrementalLexer::Edit (
+    size_t offset,
+    size_t removedLength,
+    const char * inserted,
+    size_t insertedLength,
+    IncrementalLexStats * stats
+) {
+    assert(offset + removedLength <= m_text.size());
+    const char * oldBase = m_text.data();
+    size_t oldCount = m_tokens.size();
+
+    // the first token whose scan read the edited bytes, or the end of input
+    // when inserting there. Token ends are sorted and no scan reads more than
+    // m_maxLookahead past its token, which bounds the search.
+    size_t first = std::partition_point(m_tokens.begin(), m_tokens.end(), [&](const Token & token) {
+        return (size_t)(token.mText - oldBase) + token.mLength + m_maxLookahead <= offset;
+    }) - m_tokens.begin();
+    while (first < oldCount && m_scanEnds[first] <= offset) {
+        ++first;
+    }
+    size_t start = first < oldCount ? m_tokens[first].mText - oldBase : offset;
+
+    std::string text;
+    text.reserve(m_text.size() - removedLength + insertedLength);
+    text.append(m_text, 0, offset);
+    text.append(inserted, insertedLength);
+    text.append(m_text, offset + removedLength, std::string::npos);
+
+    std::vector<Token> oldTokens;
+    std::vector<size_t> oldScanEnds;
+    oldTokens.swap(m_tokens);
+    oldScanEnds.swap(m_scanEnds);
+    std::string oldText;
+    oldText.swap(m_text);
+    m_text.swap(text);
+
+    // everything before the first affected token is kept as it was
+    const char * base = m_text.data();
+    m_tokens.reserve(oldCount + insertedLength / 4 + 1);
+    m_scanEnds.reserve(oldCount + insertedLength / 4 + 1);
+    for (size_t i = 0; i < first; ++i) {
+        Token token = oldTokens[i];
+        token.mText = base + (token.mText - oldBase);
+        m_tokens.push_back(token);
+        m_scanEnds.push_back(oldScanEnds[i]);
+    }
+
+    // old tokens that start past the edit are found again by position
+    size_t editEnd = offset + insertedLength;
+    size_t next = first;
+    size_t resumed = LexFrom(start, m_text.size(), [&](size_t pos) {
+        if (pos < editEnd) {
+            return false;
+        }
+        size_t oldPos = pos - insertedLength + removedLength;
+        while (next < oldCount && (size_t)(oldTokens[next].mText - oldBase) < oldPos) {
+            ++next;
+        }
+        return next < oldCount && (size_t)(oldTokens[next].mText - oldBase) == oldPos;
+    });
+    size_t relexedTokens = m_tokens.size() - first;
+
+    // splice the rest of the old stream in, shifted by the edit
+    size_t reused = 0;
+    if (resumed != m_text.size()) {
+        for (size_t i = next; i < oldCount; ++i) {
+            Token token = oldTokens[i];
+            token.mText = base + (token.mText - oldBase) - removedLength + insertedLength;
+            m_tokens.push_back(token);
+            m_scanEnds.push_back(oldScanEnds[i] - removedLength + insertedLength);
+        }
+        reused = oldCount - next;
+    }
+
+    if (stats) {
+        stats->m_relexedTokens = relexedTokens;
+        stats->m_relexedBytes = resumed - start;
+        stats->m_reusedTokens = first + reused;
+    }
+}
+
+//=========================================================
+// lexes from offset until the end of the text or until resume accepts a
+// token boundary, returns where it stopped
+template <typename Resume>
+size_t IncrementalLexer::LexFrom (size_t offset, size_t length, Resume resume) {
+    const char * text = m_text.data();
+    const char * curr = text + offset;
+    const char * end = text + length;
+    while (curr != end && !resume((size_t)(curr - text))) {
+        DfaCursor cursor;
+        InternalStartCursor(m_table, m_rootIndex, curr, cursor);
+        const char * stop = InternalWalkFrozen<false>(m_table, cursor, curr, end);
+        unsigned int tokenType;
+        size_t tokenLength = InternalFinishWalk(m_table, cursor, curr, stop, tokenType);
+        m_tokens.push_back(InternalMakeToken(curr, tokenLength, tokenType));
+
+        // the byte the walk died on was read too, running out of input
+        // counts as reading the end
+        size_t scanEnd = (size_t)(stop - text) + 1;
+        m_scanEnds.push_back(scanEnd);
+        curr += m_tokens.back().mLength;
+        m_maxLookahead = std::max(m_maxLookahead, scanEnd - (size_t)(curr - text));
+    }
+    return curr - text;
+}
+
+//=========================================================
+size_t IncrementalLexer::LexFrom (size_t offset, size_t length) {
+    return LexFrom(offset, length, [](size_t) { return false; });
+}
+
+//=========================================================
+// SymbolTable
+//
+
+//=========================================================
+static uint32_t InternalHashName (const char * text, size_t length) {
+    uint32_t hash = 0x811C9DC5u;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ (unsigned char)text[i]) * 0x01000193u;
+    }
+    return hash;
+}
+
+//=========================================================
+SymbolTable::SymbolTable () :
+    m_slots(64, 0),
+    m_blockUsed(0),
+    m_blockSize(0)
+{}
+
+//=========================================================
+uint32_t SymbolTable::Intern (const char * text, size_t length) {
+    uint32_t hash = InternalHashName(text, length);
+    size_t slot = FindSlot(text, length, hash);
+    if (m_slots[slot]) {
+        return m_slots[slot] - 1;
+    }
+
+    // names are packed into blocks that are never moved
+    if (m_blockUsed + length > m_blockSize) {
+        m_blockSize = std::max<size_t>(m_blockSize * 2, std::max<size_t>(length, 4096));
+        m_blocks.push_back(std::unique_ptr<char[]>(new char[m_blockSize]));
+        m_blockUsed = 0;
+    }
+    char * stored = m_blocks.back().get() + m_blockUsed;
+    memcpy(stored, text, length);
+    m_blockUsed += length;
+
+    uint32_t symbol = (uint32_t)m_names.size();
+    m_names.push_back(Entry{ stored, (uint32_t)length, hash });
+    m_slots[slot] = symbol + 1;
+    if (m_names.size() * 2 > m_slots.size()) {
+        Grow();
+    }
+    return symbol;
+}
+
+//=========================================================
+uint32_t SymbolTable::Find (const char * text, size_t length) const {
+    size_t slot = FindSlot(text, length, InternalHashName(text, length));
+    return m_slots[slot] ? m_slots[slot] - 1 : INVALID_SYMBOL;
+}
+
+//=========================================================
+// the slot holding the name, or the empty slot it would go in
+size_t SymbolTable::FindSlot (const char * text, size_t length, uint32_t hash) const {
+    size_t mask = m_slots.size() - 1;
+    for (size_t slot = hash & mask; ; slot = (slot + 1) & mask) {
+        uint32_t entry = m_slots[slot];
+        if (!entry) {
+            return slot;
+        }
+        const Entry & name = m_names[entry - 1];
+        if (name.m_hash == hash && name.m_length == length && memcmp(name.m_text, text, length) == 0) {
+            return slot;
+        }
+    }
+}
+
+//=========================================================
+void SymbolTable::Grow () {
+    std::vector<uint32_t> slots(m_slots.size() * 2, 0);
+    size_t mask = slots.size() - 1;
+    for (uint32_t symbol = 0; symbol < m_names.size(); ++symbol) {
+        size_t slot = m_names[symbol].m_hash & mask;
+        while (slots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = symbol + 1;
+    }
+    m_slots.swap(slots);
+}
+
+//=========================================================
+// LiteralValues
+//
+
+// doubles hold integers below 2^53 and powers of ten to 1e22 exactly
+static const uint64_t MAX_EXACT_MANTISSA = (uint64_t)1 << 53;
+static const int MAX_EXACT_POWER = 22;
+static const int MAX_MANTISSA_DIGITS = 19;
+
+static const double s_exactPowers[MAX_EXACT_POWER + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+//=========================================================
+static bool InternalDecodeInteger (const char * text, size_t length, int64_t & outValue) {
+    int64_t value = 0;
+    for (size_t i = 0; i < length; ++i) {
+        int digit = text[i] - '0';
+        if (digit < 0 || digit > 9 || value > (INT64_MAX - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+    outValue = value;
+    return length != 0;
+}
+
+//=========================================================
+// strtod in the C locale, so a host program that sets a locale with a
+// decimal comma does not change what a literal means
+static double InternalParseDouble (const char * text, char ** outEnd) {
+#if defined(_WIN32)
+    static _locale_t s_cLocale = _create_locale(LC_NUMERIC, "C");
+    return _strtod_l(text, outEnd, s_cLocale);
+#else
+    static locale_t s_cLocale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+    return strtod_l(text, outEnd, s_cLocale);
+#endif
+}
+
+//=========================================================
+// digits '.' digits, then an optional exponent and 'f'. Up to 19 digits
+// with a small exponent are converted exactly with one multiply or divide,
+// anything else goes through strtod. Values out of range do not decode.
+static bool InternalDecodeFloat (const char * text, size_t length, double & outValue) {
+    const char * curr = text;
+    const char * end = text + length;
+    bool single = length && end[-1] == 'f';
+    if (single) {
+        --end;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool exact = true;
+    bool seenDot = false;
+    int fractionDigits = 0;
+    for (; curr != end && (IsIntegerChar(*curr) || (*curr == '.' && !seenDot)); ++curr) {
+        if (*curr == '.') {
+            seenDot = true;
+            continue;
+        }
+        fractionDigits += seenDot ? 1 : 0;
+        if (!digits && *curr == '0') {
+            exponent -= seenDot ? 1 : 0;
+            continue;
+        }
+        if (digits < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + (*curr - '0');
+            exponent -= seenDot ? 1 : 0;
+            ++digits;
+        }
+        else {
+            exponent += seenDot ? 0 : 1;
+            exact &= *curr == '0';
+        }
+    }
+    if (!seenDot || !fractionDigits) {
+        return false;
+    }
+
+    if (curr != end && *curr == 'e') {
+        ++curr;
+        bool negative = curr != end && *curr == '-';
+        if (curr != end && (*curr == '-' || *curr == '+')) {
+            ++curr;
+        }
+        if (curr == end) {
+            return false;
+        }
+        int explicitExponent = 0;
+        for (; curr != end && IsIntegerChar(*curr); ++curr) {
+            if (explicitExponent < 100000) {
+                explicitExponent = explicitExponent * 10 + (*curr - '0');
+            }
+        }
+        exponent += negative ? -explicitExponent : explicitExponent;
+    }
+    if (curr != end) {
+        return false;
+    }
+
+    double value;
+    if (exact && mantissa <= MAX_EXACT_MANTISSA && exponent >= -MAX_EXACT_POWER && exponent <= MAX_EXACT_POWER) {
+        value = exponent < 0 ? (double)mantissa / s_exactPowers[-exponent] : (double)mantissa * s_exactPowers[exponent];
+    }
+    else {
+        // the span is not terminated, a following letter would be read as
+        // part of it. Literals this long are rare enough to go to the heap.
+        char buffer[128];
+        std::string longCopy;
+        size_t spanLength = end - text;
+        const char * terminated = buffer;
+        if (spanLength < sizeof(buffer)) {
+            memcpy(buffer, text, spanLength);
+            buffer[spanLength] = '\0';
+        }
+        else {
+            longCopy.assign(text, spanLength);
+            terminated = longCopy.c_str();
+        }
+
+        char * stop;
+        errno = 0;
+        value = InternalParseDouble(terminated, &stop);
+        if (errno == ERANGE || stop != terminated + spanLength) {
+            return false;
+        }
+    }
+    if (single && (value > FLT_MAX || value < -FLT_MAX)) {
+        return false;
+    }
+    outValue = single ? (double)(float)value : value;
+    return true;
+}
+
+//=========================================================
+const uint32_t LiteralValues::NO_LITERAL;
+
+//=========================================================
+LiteralValues::LiteralValues () :
+    m_blockUsed(0),
+    m_blockSize(0)
+{}
+
+//=========================================================
+void LiteralValues::Clear () {
+    m_slots.clear();
+    m_values.clear();
+    m_blocks.clear();
+    m_blockUsed = 0;
+    m_blockSize = 0;
+}
+
+//=========================================================
+void LiteralValues::Add (const Token & token) {
+    unsigned int tokenType = token.mTokenType;
+    if (tokenType != TokenType::IntegerLiteral &&
+        tokenType != TokenType::FloatLiteral &&
+        tokenType != TokenType::StringLiteral &&
+        tokenType != TokenType::CharacterLiteral) {
+        m_slots.push_back(NO_LITERAL);
+        return;
+    }
+
+    assert(m_values.size() < NO_LITERAL);
+    m_slots.push_back((uint32_t)m_values.size());
+    m_values.push_back(LiteralValue());
+    LiteralValue & value = m_values.back();
+
+    if (tokenType == TokenType::IntegerLiteral) {
+        value.m_valid = InternalDecodeInteger(token.mText, token.mLength, value.m_integer);
+        return;
+    }
+    if (tokenType == TokenType::FloatLiteral) {
+        value.m_valid = InternalDecodeFloat(token.mText, token.mLength, value.m_float);
+        return;
+    }
+
+    // the body between the quotes, escapes only ever shrink it
+    if (token.mLength < 2) {
+        return;
+    }
+    const char * body = token.mText + 1;
+    const char * bodyEnd = token.mText + token.mLength - 1;
+    char * text = AllocateText(bodyEnd - body);
+    char * out = text;
+    for (const char * curr = body; curr != bodyEnd; ++curr) {
+        if (*curr != '\\' || curr + 1 == bodyEnd) {
+            *out++ = *curr;
+            continue;
+        }
+        switch (*++curr) {
+            case 'n': *out++ = '\n'; break;
+            case 'r': *out++ = '\r'; break;
+            case 't': *out++ = '\t'; break;
+            default:  *out++ = *curr; break;
+        }
+    }
+    *out = '\0';
+
+    value.m_text = text;
+    value.m_length = out - text;
+    value.m_valid = true;
+    if (tokenType == TokenType::CharacterLiteral && value.m_length == 1) {
+        value.m_integer = (unsigned char)text[0];
+    }
+}
+
+//=========================================================
+// room for length bytes and a terminator, in blocks that are never moved
+char * LiteralValues::AllocateText (size_t length) {
+    if (m_blockUsed + length + 1 > m_blockSize) {
+        m_blockSize = std::max<size_t>(m_blockSize * 2, std::max<size_t>(length + 1, 4096));
+        m_blocks.push_back(std::unique_ptr<char[]>(new char[m_blockSize]));
+        m_blockUsed = 0;
+    }
+    char * text = m_blocks.back().get() + m_blockUsed;
+    m_blockUsed += length + 1;
+    return text;
+}
+
+//=========================================================
+// LineIndex
+//
+
+//=========================================================
+LineIndex::LineIndex (const char * data, size_t length) :
+    m_data(data),
+    m_length(length),
+    m_built(false)
+{}
+
+//=========================================================
+SourceLocation LineIndex::Locate (size_t offset) {
+    assert(offset <= m_length);
+    if (!m_built) {
+        Build();
+    }
+
+    // the last line starting at or before offset
+    std::vector<size_t>::const_iterator line = std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), offset) - 1;
+    SourceLocation location;
+    location.m_line = (line - m_lineStarts.begin()) + 1;
+    location.m_column = offset - *line + 1;
+    return location;
+}
+
+//=========================================================
+size_t LineIndex::LineCount () {
+    if (!m_built) {
+        Build();
+    }
+    return m_lineStarts.size();
+}
+
+//=========================================================
+void LineIndex::Build () {
+    // sources average a few dozen bytes a line
+    m_lineStarts.reserve(m_length / 32 + 1);
+    m_lineStarts.push_back(0);
+    InternalSelectNewlineFinder()(m_data, m_length, m_lineStarts);
+    m_built = true;
+}
+
+//=========================================================
+// TokenStream
+//
+
+// every type has to fit the byte stored per token
+static_assert(TokenType::KeywordStart + KEYWORD_COUNT < 256, "token types no longer fit a byte");
+
+//=========================================================
+TokenStream::TokenStream () :
+    m_base(nullptr)
+{}
+
+//=========================================================
+void TokenStream::Reset (const char * base) {
+    m_base = base;
+    m_types.clear();
+    m_offsets.clear();
+    m_lengths.clear();
+}
+
+//=========================================================
+void TokenStream::Reserve (size_t count) {
+    m_types.reserve(count);
+    m_offsets.reserve(count);
+    m_lengths.reserve(count);
+}
+
+//=========================================================
+void TokenStream::Push (const char * text, size_t length, unsigned int tokenType) {
+    assert(text >= m_base && (size_t)(text - m_base) + length <= UINT32_MAX);
+    m_types.push_back((uint8_t)tokenType);
+    m_offsets.push_back((uint32_t)(text - m_base));
+    m_lengths.push_back((uint32_t)length);
+}
+
+//=========================================================
+Token TokenStream::operator[] (size_t index) const {
+    Token token;
+    token.mText = m_base + m_offsets[index];
+    token.mLength = m_lengths[index];
+    token.mTokenType = m_types[index];
+    return token;
+}
+
+//=========================================================
+size_t TokenStream::MemoryBytes () const {
+    return
+        m_types.capacity() * sizeof(uint8_t) +
+        m_offsets.capacity() * sizeof(uint32_t) +
+        m_lengths.capacity() * sizeof(uint32_t);
 }
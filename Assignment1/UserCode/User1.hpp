@@ -0,0 +1,656 @@
+/******************************************************************\
+ * Author: Nicco Simone
+ * Copyright 2015, DigiPen Institute of Technology
+\******************************************************************/
+
+#pragma once
+#include <stdint.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Drivers/Driver1.hpp"
+
+struct DfaEdge;
+struct DfaTable;
+
+typedef bool (*EdgeCondition)(const DfaEdge * edge,  char c);
+
+//=========================================================
+struct LexerStats {
+    size_t m_bytes;
+    size_t m_tokens;
+    double m_seconds;
+    double m_bytesPerSecond;
+};
+
+//=========================================================
+struct DfaMinimizeStats {
+    int m_statesBefore;
+    int m_statesAfter;
+    int m_edgesBefore;
+    int m_edgesAfter;
+};
+
+//=========================================================
+// Read only mapping of a source file. Tokens lexed from it point straight
+// into the mapping and stay valid until it is closed.
+class MappedSource {
+public:
+    MappedSource ();
+    ~MappedSource ();
+    MappedSource (const MappedSource &) = delete;
+    MappedSource & operator= (const MappedSource &) = delete;
+
+    bool Open (const char * path);
+    void Close ();
+
+    const char * Data () const { return m_data; }
+    size_t Size () const { return m_size; }
+
+private:
+    const char * m_data;
+    size_t m_size;
+#if defined(_WIN32)
+    void * m_file;
+    void * m_mapping;
+#endif
+};
+
+//=========================================================
+struct DfaTableStats {
+    // including the dead row
+    int m_rows;
+    int m_byteClasses;
+    // transitions, token types, end of input flags, runs and the class map
+    size_t m_tableBytes;
+    // the same with a column per byte
+    size_t m_uncompressedBytes;
+};
+
+//=========================================================
+struct DfaArenaStats {
+    size_t m_states;
+    size_t m_peakStates;
+    size_t m_edges;
+    size_t m_peakEdges;
+    // memory held by both arenas, used or not
+    size_t m_reservedBytes;
+};
+
+//=========================================================
+// Bump allocator over chunks that double in size. Items are value
+// initialized when handed out and keep their address until Reset, which
+// rewinds to the first chunk and keeps the memory for the next build.
+template <typename T>
+class DfaArena {
+public:
+    DfaArena () :
+        m_chunk(0),
+        m_used(0),
+        m_count(0),
+        m_peak(0),
+        m_capacity(0)
+    {}
+    DfaArena (const DfaArena &) = delete;
+    DfaArena & operator= (const DfaArena &) = delete;
+
+    T * Allocate () {
+        if (m_chunk < m_chunks.size() && m_used == m_chunks[m_chunk].m_size) {
+            ++m_chunk;
+            m_used = 0;
+        }
+        if (m_chunk == m_chunks.size()) {
+            size_t size = m_chunks.empty() ? FIRST_CHUNK_SIZE : m_chunks.back().m_size * 2;
+            m_chunks.push_back(Chunk{ std::unique_ptr<T[]>(new T[size]), size });
+            m_capacity += size;
+        }
+
+        T * item = &m_chunks[m_chunk].m_items[m_used++];
+        *item = T();
+        if (++m_count > m_peak) {
+            m_peak = m_count;
+        }
+        return item;
+    }
+
+    void Reset () {
+        m_chunk = 0;
+        m_used = 0;
+        m_count = 0;
+    }
+
+    // oldest first
+    template <typename Visit>
+    void ForEach (Visit visit) {
+        for (size_t chunk = 0; chunk < m_chunks.size() && chunk <= m_chunk; ++chunk) {
+            size_t used = chunk < m_chunk ? m_chunks[chunk].m_size : m_used;
+            for (size_t i = 0; i < used; ++i) {
+                visit(&m_chunks[chunk].m_items[i]);
+            }
+        }
+    }
+
+    // the first item handed out since the last Reset
+    const T * First () const { return m_count ? &m_chunks[0].m_items[0] : nullptr; }
+
+    size_t Count () const { return m_count; }
+    size_t Peak () const { return m_peak; }
+    size_t Capacity () const { return m_capacity; }
+
+private:
+    static const size_t FIRST_CHUNK_SIZE = 64;
+
+    struct Chunk {
+        std::unique_ptr<T[]> m_items;
+        size_t m_size;
+    };
+
+    std::vector<Chunk> m_chunks;
+    size_t m_chunk;
+    size_t m_used;
+    size_t m_count;
+    size_t m_peak;
+    size_t m_capacity;
+};
+
+//=========================================================
+// Owns the states, edges and frozen tables of the automata built in it.
+// Building is single threaded, a frozen automaton is only ever read so
+// lexers on any number of threads can share it. The free functions of
+// Driver1.hpp build in the default context, except CreateLanguageDfa which
+// returns StaticLanguageDfa and leaves it alone in DeleteStateAndChildren.
+class DfaContext {
+public:
+    DfaContext ();
+    ~DfaContext ();
+    DfaContext (const DfaContext &) = delete;
+    DfaContext & operator= (const DfaContext &) = delete;
+
+    static DfaContext & Default ();
+
+    DfaState * AddState (int acceptingToken);
+    void AddEdge (DfaState * from, DfaState * to, char c);
+    void AddDefaultEdge (DfaState * from, DfaState * to);
+    // root must be the first state added, everything built in the context
+    // goes with it
+    void DeleteStateAndChildren (DfaState * root);
+
+    // current and peak usage of the state and edge arenas
+    void GetArenaStats (DfaArenaStats & stats) const;
+
+    // Lowers the graph reachable from root into a dense transition table.
+    // ReadToken and ReadLanguageToken run on the table for any frozen state,
+    // so the graph must be complete before it is frozen.
+    void FreezeDfa (DfaState * root);
+
+    // Merges equivalent rows of root's frozen table, keeping accepting token
+    // types apart. Freezes root first if needed. Call it before handing the
+    // table to any lexer, edges are counted as distinct (state, target) pairs.
+    void MinimizeDfa (DfaState * root, DfaMinimizeStats * stats = nullptr);
+
+    // Renumbers the rows of root's frozen table so the rows in order, given
+    // by their current index, come first and in that order. The rest keep
+    // their relative order after them. Like MinimizeDfa, call it before
+    // handing the table to any lexer.
+    void ReorderDfa (DfaState * root, const std::vector<uint16_t> & order);
+
+    // frozen, MinimizeDfa has nothing to merge in it
+    DfaState * CreateLanguageDfa ();
+
+    // Maps a table written by SaveDfa, the rows are not copied so processes
+    // loading the same file share its pages. Only the small run table is
+    // rebuilt from them. The returned root lexes like the one that was saved
+    // but has no graph to edit. Returns null if the file is missing,
+    // damaged, or from another version or byte order.
+    DfaState * LoadDfa (const char * path);
+
+private:
+    void InternalAddEdge (DfaState * from, DfaState * to, char c, EdgeCondition condition);
+
+    DfaArena<DfaState> m_states;
+    DfaArena<DfaEdge> m_edges;
+    std::vector<std::unique_ptr<DfaTable>> m_tables;
+};
+
+//=========================================================
+// DfaContext::FreezeDfa, MinimizeDfa and LoadDfa on the default context
+void FreezeDfa (DfaState * root);
+void MinimizeDfa (DfaState * root, DfaMinimizeStats * stats = nullptr);
+void ReorderDfa (DfaState * root, const std::vector<uint16_t> & order);
+DfaState * LoadDfa (const char * path);
+
+//=========================================================
+// Lexes a sample with root's frozen table and lists its rows most visited
+// first, a row is visited once per byte lexed in it. Handing the order to
+// ReorderDfa packs the hot rows into the first cache lines. The numbering
+// of a built automaton is deterministic, so an order profiled once can be
+// kept and applied to every build, and SaveDfa writes the reordered table.
+void ProfileDfa (DfaState * root, const char * data, size_t length, std::vector<uint16_t> & outOrder);
+
+//=========================================================
+// Size of root's frozen table, root must be frozen
+void GetDfaTableStats (const DfaState * root, DfaTableStats & stats);
+
+//=========================================================
+// Writes root's frozen table for LoadDfa. Returns false if the file could
+// not be written.
+bool SaveDfa (DfaState * root, const char * path);
+
+//=========================================================
+// Scanner compiled from the source EmitScanner writes. Scans one token of
+// [stream, end) with the same rules as TokenizeAll and returns its length,
+// zero for a byte that starts no token.
+typedef size_t (*ScannerFunction)(const char * stream, const char * end, unsigned int & outTokenType);
+
+//=========================================================
+// Writes C++ source defining functionName as a ScannerFunction for root's
+// frozen table, one label per state and a switch per transition, so the
+// compiled scanner does no table loads. Returns false if the file could
+// not be written.
+bool EmitScanner (DfaState * root, const char * functionName, const char * path);
+
+//=========================================================
+struct ScannerBenchmarkStats {
+    LexerStats m_scanner;
+    LexerStats m_table;
+    // a ReadLanguageToken call per token
+    LexerStats m_readToken;
+    // all three produced the same tokens
+    bool m_identical;
+};
+
+//=========================================================
+// Lexes data with scanner, with TokenizeAll on root and token by token
+// with ReadLanguageToken on root. data must not contain NUL and
+// data[length] must be NUL, ReadLanguageToken reads up to it.
+void BenchmarkScanner (
+    ScannerFunction scanner,
+    DfaState * root,
+    const char * data,
+    size_t length,
+    ScannerBenchmarkStats & stats
+);
+
+//=========================================================
+// The language automaton as the table checked in as LanguageTable.inl,
+// nothing is constructed on first use beyond a few pointers. Lexes like
+// CreateLanguageDfa and can be shared by any thread, but it is owned by no
+// context: never delete or minimize it.
+DfaState * StaticLanguageDfa ();
+
+//=========================================================
+// Writes the frozen table of CreateLanguageDfa as C++ source for
+// StaticLanguageDfa, the generator of UserCode/LanguageTable.inl. Run it
+// after changing CreateLanguageDfa or the driver token lists, a table
+// generated from other token lists is ignored. Returns false if the file
+// could not be written or a token type has no TokenType enumerator.
+bool EmitLanguageTable (const char * path);
+
+//=========================================================
+// ReadLanguageToken on StaticLanguageDfa
+void ReadLanguageToken (const char * stream, Token & outToken);
+
+//=========================================================
+// Appends the language tokens of data[0, length) to tokens in one pass.
+// No terminator is needed and NUL is lexed like any other byte, a byte that
+// starts no token becomes a one byte invalid token. Input that ends inside an
+// unclosed comment or string becomes a single token to the end, so those
+// bytes are not scanned again; other unfinished tokens back off to their
+// longest match, "1." at the end is an integer and a dot. root must be frozen.
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// TokenizeAll that drops whitespace and comments as they are scanned, so
+// they never reach tokens. If leadingTrivia is given it runs parallel to
+// tokens and gets the number of trivia bytes right before each token; the
+// trivia after the last token is whatever is left of data.
+void TokenizeSignificant (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    std::vector<uint32_t> * leadingTrivia = nullptr,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// TokenizeAll split over threadCount threads, 0 uses every core. Each
+// chunk is lexed speculatively from the root and stitched back where it
+// agrees with the sequential lex, so the result is identical to
+// TokenizeAll. Small inputs are lexed on the calling thread.
+void TokenizeParallel (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    unsigned threadCount = 0,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// Tokens of one source stored as parallel arrays: a byte of type and 32 bit
+// offset and length, 9 bytes a token against sizeof(Token). Loops that only
+// look at types walk Types() densely. Sources are limited to 4GB.
+class TokenStream {
+public:
+    TokenStream ();
+
+    // drops every token, new ones are offsets into base
+    void Reset (const char * base);
+    void Reserve (size_t count);
+    void Push (const char * text, size_t length, unsigned int tokenType);
+
+    size_t Size () const { return m_types.size(); }
+    const uint8_t * Types () const { return m_types.data(); }
+    TokenType::Enum Type (size_t index) const { return (TokenType::Enum)m_types[index]; }
+    const char * Text (size_t index) const { return m_base + m_offsets[index]; }
+    size_t Offset (size_t index) const { return m_offsets[index]; }
+    size_t Length (size_t index) const { return m_lengths[index]; }
+    // a Token pointing into the source, built on the fly
+    Token operator[] (size_t index) const;
+
+    size_t MemoryBytes () const;
+
+private:
+    const char * m_base;
+    std::vector<uint8_t> m_types;
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_lengths;
+};
+
+//=========================================================
+// TokenizeAll into a TokenStream, which is reset to data first.
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    TokenStream & tokens,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+struct LexInput {
+    const char * m_data;
+    size_t m_length;
+};
+
+//=========================================================
+// tokens [m_first, m_first + m_count) of the shared output belong to one input
+struct TokenRange {
+    size_t m_first;
+    size_t m_count;
+};
+
+//=========================================================
+// TokenizeAll over many small inputs in one call, without the setup a call
+// per input pays. The tokens of every input go to the one shared vector in
+// input order, ranges[i] says where those of inputs[i] are. Stats count
+// all inputs together.
+void TokenizeBatch (
+    DfaState * root,
+    const LexInput * inputs,
+    size_t inputCount,
+    std::vector<Token> & tokens,
+    std::vector<TokenRange> & ranges,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// Hands every distinct name a dense id from 0, so names compare as
+// integers. Each name is stored once and the pointer stays valid for the
+// table's lifetime.
+class SymbolTable {
+public:
+    static const uint32_t INVALID_SYMBOL = 0xFFFFFFFF;
+
+    SymbolTable ();
+    SymbolTable (const SymbolTable &) = delete;
+    SymbolTable & operator= (const SymbolTable &) = delete;
+
+    uint32_t Intern (const char * text, size_t length);
+    // INVALID_SYMBOL if the name was never interned
+    uint32_t Find (const char * text, size_t length) const;
+
+    const char * Name (uint32_t symbol) const { return m_names[symbol].m_text; }
+    size_t NameLength (uint32_t symbol) const { return m_names[symbol].m_length; }
+    size_t Count () const { return m_names.size(); }
+
+private:
+    struct Entry {
+        const char * m_text;
+        uint32_t m_length;
+        uint32_t m_hash;
+    };
+
+    size_t FindSlot (const char * text, size_t length, uint32_t hash) const;
+    void Grow ();
+
+    std::vector<Entry> m_names;
+    // symbol + 1 per slot, zero for an empty slot, kept under half full
+    std::vector<uint32_t> m_slots;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_blockUsed;
+    size_t m_blockSize;
+};
+
+//=========================================================
+// TokenizeAll that also interns identifiers. symbolIds runs parallel to
+// tokens and gets the symbol of every identifier, INVALID_SYMBOL for any
+// other token.
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    SymbolTable & symbols,
+    std::vector<uint32_t> & symbolIds,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// Decoded value of a literal token. Integers and character literals of one
+// byte fill m_integer, floats m_float, and string and character literals
+// get their unescaped body in m_text, NUL terminated.
+struct LiteralValue {
+    int64_t m_integer;
+    double m_float;
+    const char * m_text;
+    size_t m_length;
+    // false if the span does not decode, e.g. an integer that overflows
+    bool m_valid;
+};
+
+//=========================================================
+// Values of the literal tokens of a token vector, looked up by token index.
+// Unescaped text lives in blocks owned by the table and stays valid until
+// Clear or destruction.
+class LiteralValues {
+public:
+    static const uint32_t NO_LITERAL = 0xFFFFFFFF;
+
+    LiteralValues ();
+    LiteralValues (const LiteralValues &) = delete;
+    LiteralValues & operator= (const LiteralValues &) = delete;
+
+    void Clear ();
+    // decodes the token at the next index, non literal tokens store nothing
+    void Add (const Token & token);
+
+    size_t TokenCount () const { return m_slots.size(); }
+    // null if the token is not a literal
+    const LiteralValue * Find (size_t tokenIndex) const {
+        return m_slots[tokenIndex] != NO_LITERAL ? &m_values[m_slots[tokenIndex]] : nullptr;
+    }
+
+private:
+    char * AllocateText (size_t length);
+
+    // index into m_values per token
+    std::vector<uint32_t> m_slots;
+    std::vector<LiteralValue> m_values;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_blockUsed;
+    size_t m_blockSize;
+};
+
+//=========================================================
+// TokenizeAll that also decodes literal values. literals runs parallel to
+// tokens and is appended to like it.
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    LiteralValues & literals,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// What TokenizeAll can fill in next to the tokens, any member may be null.
+// symbols interns every identifier and symbolIds, which needs symbols, gets
+// the ids as in the SymbolTable overload. literals is filled as in the
+// LiteralValues overload.
+struct TokenAnnotations {
+    SymbolTable * m_symbols;
+    std::vector<uint32_t> * m_symbolIds;
+    LiteralValues * m_literals;
+};
+
+//=========================================================
+// TokenizeAll that interns identifiers and decodes literals in the same
+// pass, each token is handled while its bytes are still in cache.
+void TokenizeAll (
+    DfaState * root,
+    const char * data,
+    size_t length,
+    std::vector<Token> & tokens,
+    const TokenAnnotations & annotations,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// Maps path into source and lexes it in place with TokenizeAll. Returns
+// false if the file could not be mapped.
+bool TokenizeFile (
+    DfaState * root,
+    const char * path,
+    MappedSource & source,
+    std::vector<Token> & tokens,
+    LexerStats * stats = nullptr
+);
+
+//=========================================================
+// Lexes input handed over in arbitrary chunks. A token that runs off the
+// end of a chunk is carried into the next one, so memory is bounded by the
+// longest token rather than the input. Tokens passed to the callback point
+// into the chunk or the carry buffer and only live for the call.
+class StreamingLexer {
+public:
+    typedef std::function<void (const Token &)> TokenCallback;
+
+    StreamingLexer (DfaState * root, TokenCallback callback);
+
+    void Feed (const char * data, size_t length);
+    // end of input, flushes the carried token
+    void Finish ();
+
+private:
+    void FlushCarry ();
+
+    const DfaTable * m_table;
+    uint16_t m_rootIndex;
+
+    // walk of the carried token
+    uint16_t m_state;
+    uint16_t m_acceptingState;
+    size_t m_acceptingLength;
+    std::string m_carry;
+
+    TokenCallback m_callback;
+};
+
+//=========================================================
+struct IncrementalLexStats {
+    size_t m_relexedTokens;
+    size_t m_relexedBytes;
+    // tokens kept from before the edit, on either side of it
+    size_t m_reusedTokens;
+};
+
+//=========================================================
+// Keeps a text and its tokens in step through edits. An edit is lexed
+// again from the first token whose scan read an edited byte, and lexing
+// stops at the first boundary that lands on an old token start past the
+// edit. Every token starts from the root, so the tail of the old stream is
+// spliced in with its offsets shifted. Tokens point into Text() and live
+// until the next edit.
+class IncrementalLexer {
+public:
+    explicit IncrementalLexer (DfaState * root);
+
+    void Reset (const char * text, size_t length);
+    // replaces removedLength bytes at offset with inserted
+    void Edit (
+        size_t offset,
+        size_t removedLength,
+        const char * inserted,
+        size_t insertedLength,
+        IncrementalLexStats * stats = nullptr
+    );
+
+    const std::string & Text () const { return m_text; }
+    const std::vector<Token> & Tokens () const { return m_tokens; }
+
+private:
+    template <typename Resume>
+    size_t LexFrom (size_t offset, size_t length, Resume resume);
+    size_t LexFrom (size_t offset, size_t length);
+
+    const DfaTable * m_table;
+    uint16_t m_rootIndex;
+
+    std::string m_text;
+    std::vector<Token> m_tokens;
+    // one past the last byte each token's scan read, Text().size() + 1 if
+    // it ran into the end
+    std::vector<size_t> m_scanEnds;
+    // the furthest any scan read past its token, only grows until Reset
+    size_t m_maxLookahead;
+};
+
+//=========================================================
+// 1 based, columns count bytes
+struct SourceLocation {
+    size_t m_line;
+    size_t m_column;
+};
+
+//=========================================================
+// Line and column of any offset into a source. Nothing is scanned until
+// the first lookup, which finds every newline with vector compares; after
+// that a lookup is a binary search over line starts. A line ends at '\n'.
+// Lookups build the index, so share one between threads only once built.
+class LineIndex {
+public:
+    LineIndex (const char * data, size_t length);
+
+    SourceLocation Locate (size_t offset);
+    SourceLocation Locate (const char * text) { return Locate((size_t)(text - m_data)); }
+    size_t LineCount ();
+
+private:
+    void Build ();
+
+    const char * m_data;
+    size_t m_length;
+    bool m_built;
+    // offset of the first byte of every line
+    std::vector<size_t> m_lineStarts;
+};
@@ -5,6 +5,8 @@
 
 #include <assert.h>
 #include <map>
+#include <memory>
+#include <vector>
 #include "../Drivers/Driver1.hpp"
 
 //=========================================================
@@ -12,18 +14,61 @@
 //
 
 static const int NOT_ACCEPTING           = 0;
-static const int MAX_STATES              = 512;
-static const int MAX_EDGES               = 1024;
 static const char DEFAULT_EDGE_CONDITION = CHAR_MAX;
 
 class DfaState;
 struct DfaEdge;
 
-static DfaState * s_states = nullptr;
-static int s_stateIndex    = 0;
-static DfaEdge * s_edges = nullptr;
-static int s_edgeIndex = 0;
-static std::map<std::string, unsigned> s_keywordToId;
+//=========================================================
+// Bump allocator over chunks that double in size. Items are value
+// initialized when handed out and keep their address until Reset, which
+// rewinds to the first chunk and keeps the memory for the next build.
+template <typename T>
+class DfaArena {
+public:
+    DfaArena () :
+        m_chunk(0),
+        m_used(0)
+    {}
+    DfaArena (const DfaArena &) = delete;
+    DfaArena & operator= (const DfaArena &) = delete;
+
+    T * Allocate () {
+        if (m_chunk < m_chunks.size() && m_used == m_chunks[m_chunk].m_size) {
+            ++m_chunk;
+            m_used = 0;
+        }
+        if (m_chunk == m_chunks.size()) {
+            size_t size = m_chunks.empty() ? FIRST_CHUNK_SIZE : m_chunks.back().m_size * 2;
+            m_chunks.push_back(Chunk{ std::unique_ptr<T[]>(new T[size]), size });
+        }
+
+        T * item = &m_chunks[m_chunk].m_items[m_used++];
+        *item = T();
+        return item;
+    }
+
+    void Reset () {
+        m_chunk = 0;
+        m_used = 0;
+    }
+
+    // the first item handed out since the last Reset
+    const T * First () const { return m_chunk || m_used ? &m_chunks[0].m_items[0] : nullptr; }
+
+private:
+    static const size_t FIRST_CHUNK_SIZE = 64;
+
+    struct Chunk {
+        std::unique_ptr<T[]> m_items;
+        size_t m_size;
+    };
+
+    std::vector<Chunk> m_chunks;
+    size_t m_chunk;
+    size_t m_used;
+};
+
 
 typedef bool (*EdgeCondition)(const DfaEdge * edge,  char c);
 
@@ -65,15 +110,25 @@ public:
 struct DfaTokenReader {
     const char * m_stream;
     int m_tokenLength;
-    DfaState * m_lastAcceptingState;
-    DfaState * m_nextAcceptingState;
-    bool m_error;
+    unsigned int m_tokenType;
 };
 
 //=========================================================
 // Private Methods
 //
 
+//=========================================================
+static DfaArena<DfaState> & InternalStateArena () {
+    static DfaArena<DfaState> arena;
+    return arena;
+}
+
+//=========================================================
+static DfaArena<DfaEdge> & InternalEdgeArena () {
+    static DfaArena<DfaEdge> arena;
+    return arena;
+}
+
 //=========================================================
 static bool SimpleEdgeCondition (const DfaEdge * edge, char c) {
     return edge->m_simpleCondition == c;
@@ -115,15 +170,8 @@ static bool EndOfLineEdgeCondition(const DfaEdge * edge, char c) {
 
 //=========================================================
 static void InternalAddEdge (DfaState * from, DfaState * to, char c, EdgeCondition condition) {
-    assert(s_edgeIndex < MAX_EDGES);
-    if (!s_edges) {
-        static DfaEdge edges[MAX_EDGES];
-        s_edges = edges;
-        memset(s_edges, 0, sizeof(s_edges) / sizeof(s_edges[0]));
-    }
-
     // link new edge in state
-    DfaEdge * edge = &s_edges[s_edgeIndex++];
+    DfaEdge * edge = InternalEdgeArena().Allocate();
     if (c == DEFAULT_EDGE_CONDITION) {
         assert(!from->m_defaultEdge);
         from->m_defaultEdge = edge;
@@ -149,49 +197,39 @@ static void InternalResetEdge (DfaEdge * edge) {
 }
 
 //=========================================================
-static void InternalParseToken (DfaTokenReader * reader, DfaState * state, int streamOffset) {
-    // save position if this state is accepting
-    if (state->m_accepting) {
-        // this is a signal to previous callers
-        reader->m_nextAcceptingState = state;
-
-        reader->m_lastAcceptingState = state;
-        reader->m_tokenLength = streamOffset;
-    }
-
-    if (*(reader->m_stream + streamOffset) == '\0') {
-        if (!reader->m_tokenLength) {
-            reader->m_tokenLength = streamOffset;
+// maximal munch over the graph, the last accepting state is kept in
+// locals so long tokens cost no stack
+static void InternalParseToken (DfaTokenReader * reader, DfaState * state) {
+    const char * stream = reader->m_stream;
+
+    DfaState * acceptingState = state->m_accepting ? state : nullptr;
+    int acceptingLength = 0;
+
+    int streamOffset = 0;
+    for (char c; (c = stream[streamOffset]) != '\0'; ) {
+        // first matching sibling wins, otherwise fall back on the default edge
+        DfaEdge * edge = state->m_edge;
+        while (edge && !edge->m_condition(edge, c)) {
+            edge = edge->m_nextSibling;
         }
-        return;
-    }
-
-    // look at outgoing edges to find next match
-    DfaEdge * edge = state->m_edge;
-    bool foundEdge = false;
-    while (edge) {
-        char c = *(reader->m_stream + streamOffset);
-        if (edge->m_condition(edge, c)) {
-            reader->m_nextAcceptingState = nullptr;
-            InternalParseToken(reader, edge->m_state, streamOffset + 1);
-            if (!reader->m_nextAcceptingState) {
-                reader->m_error = true;
+        if (!edge) {
+            edge = state->m_defaultEdge;
+            if (!edge) {
+                break;
             }
-            foundEdge = true;
-            break;
         }
-        edge = edge->m_nextSibling;
-    }
 
-    // if we didn't find an edge, see if we have a default edge and check that
-    if (state->m_defaultEdge && !reader->m_error && !foundEdge) {
-        assert(state->m_defaultEdge->m_condition(state->m_defaultEdge, DEFAULT_EDGE_CONDITION));
-        InternalParseToken(reader, state->m_defaultEdge->m_state, streamOffset + 1);
+        state = edge->m_state;
+        ++streamOffset;
+        if (state->m_accepting) {
+            acceptingState = state;
+            acceptingLength = streamOffset;
+        }
     }
 
-    if (!reader->m_tokenLength) {
-        reader->m_tokenLength = streamOffset;
-    }
+    // an unmatched token spans everything we read
+    reader->m_tokenType = acceptingState ? acceptingState->m_tokenType : NOT_ACCEPTING;
+    reader->m_tokenLength = acceptingLength ? acceptingLength : streamOffset;
 }
 
 //=========================================================
@@ -199,23 +237,13 @@ void InternalReadToken(DfaState * startingState, const char * stream, Token & ou
     outToken.mTokenType = 0;
 
     DfaTokenReader reader;
-    reader.m_stream                = stream;
-    reader.m_lastAcceptingState    = nullptr;
+    reader.m_stream      = stream;
     reader.m_tokenLength = 0;
-    reader.m_error = false;
-    reader.m_nextAcceptingState = nullptr;
+    reader.m_tokenType   = NOT_ACCEPTING;
 
-    InternalParseToken(&reader, startingState, 0);
+    InternalParseToken(&reader, startingState);
 
-    if (reader.m_lastAcceptingState) {
-        outToken.mTokenType = reader.m_lastAcceptingState->m_tokenType;
-        if (reader.m_lastAcceptingState->m_tokenType == TokenType::Identifier) {
-            std::string id(reader.m_stream, reader.m_tokenLength);
-            if (s_keywordToId.count(id)) {
-                outToken.mTokenType = s_keywordToId[id];
-            }
-        }
-    }
+    outToken.mTokenType = reader.m_tokenType;
     outToken.mText   = reader.m_stream;
     outToken.mLength = reader.m_tokenLength;
 }
@@ -226,17 +254,9 @@ void InternalReadToken(DfaState * startingState, const char * stream, Token & ou
 
 //=========================================================
 DfaState * AddState (int acceptingToken) {
-    assert(s_stateIndex < MAX_STATES);
-    if (s_states == nullptr) {
-        static DfaState state_pool[MAX_STATES];
-        memset(state_pool, 0, sizeof(state_pool) / sizeof(state_pool[0]));
-        s_states = state_pool;
-    }
-
-    DfaState * state = &s_states[s_stateIndex++];
+    DfaState * state = InternalStateArena().Allocate();
     state->m_accepting = acceptingToken != NOT_ACCEPTING;
     state->m_tokenType = acceptingToken;
-    state->m_edge = nullptr;
 
     return state;
 }
@@ -260,11 +280,10 @@ void ReadToken(DfaState * startingState, const char * stream, Token & outToken)
 
 //=========================================================
 void DeleteStateAndChildren (DfaState * root) {
-    s_stateIndex = 0;
-    s_keywordToId.clear();
-    s_edgeIndex = 0;
-    memset(s_states, 0, (MAX_STATES) * sizeof(DfaState));
-    memset(s_edges, 0,  MAX_EDGES * sizeof(DfaEdge));
+    // states and edges are handed out zeroed, rewinding is enough
+    assert(root == InternalStateArena().First());
+    InternalStateArena().Reset();
+    InternalEdgeArena().Reset();
 }
 
 //=========================================================
@@ -374,6 +393,30 @@ DfaState* CreateLanguageDfa() {
     InternalAddEdge(root, whiteSpace, 0, WhiteSpaceEdgeCondition);
     InternalAddEdge(whiteSpace, whiteSpace, 0, WhiteSpaceEdgeCondition);
 
+    // keywords, a trie in front of the identifier edges. Each prefix is an
+    // identifier until it spells a whole keyword and any identifier
+    // character off the trie falls back to the identifier state.
+    std::map<std::string, DfaState *> keywordStates;
+    for (unsigned i = 0; i < sizeof(s_tokenKeywords) / sizeof(s_tokenKeywords[0]); ++i) {
+        std::string prefix;
+        DfaState * parentState = root;
+        for (const char * c = s_tokenKeywords[i]; *c; ++c) {
+            prefix.push_back(*c);
+            DfaState *& prefixState = keywordStates[prefix];
+            if (!prefixState) {
+                prefixState = AddState(TokenType::Identifier);
+                AddEdge(parentState, prefixState, *c);
+            }
+            parentState = prefixState;
+        }
+        parentState->m_tokenType = TokenType::KeywordStart + 1 + i;
+    }
+    for (auto & keywordState : keywordStates) {
+        InternalAddEdge(keywordState.second, identifier, 0, AlphaEdgeCondition);
+        InternalAddEdge(keywordState.second, identifier, '_', nullptr);
+        InternalAddEdge(keywordState.second, identifier, 0, IntegerEdgeCondition);
+    }
+
     // identifier
     InternalAddEdge(root, identifier, 0, AlphaEdgeCondition);
     InternalAddEdge(root, identifier, '_', nullptr);
@@ -382,10 +425,5 @@ DfaState* CreateLanguageDfa() {
     InternalAddEdge(identifier, identifier, '_', nullptr);
     InternalAddEdge(identifier, identifier, 0, IntegerEdgeCondition);
 
-    // parse keywords
-    for (unsigned i = 0; i < sizeof(s_tokenKeywords) / sizeof(s_tokenKeywords[0]); ++i) {
-        s_keywordToId[s_tokenKeywords[i]] = TokenType::KeywordStart + 1 + i;
-    }
-
     return root;
 }
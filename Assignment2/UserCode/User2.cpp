@@ -89,7 +89,7 @@ bool Parser::Accept (TokenType::Enum tokenType) {
     if (m_streamCursor >= (int)m_tokenStream.size()) {
         return false;
     }
-    Token token = m_tokenStream[m_streamCursor];
+    const Token & token = m_tokenStream[m_streamCursor];
     bool match = token.mEnumTokenType == tokenType;
     if (match) {
         PrintRule::AcceptedToken(token);
@@ -614,7 +614,7 @@ void RemoveWhitespaceAndComments(std::vector<Token>& tokens) {
         std::remove_if(
             tokens.begin(),
             tokens.end(),
-            [](Token t) {
+            [](const Token & t) {
                 return (t.mEnumTokenType == TokenType::Whitespace)
                     || (t.mEnumTokenType == TokenType::SingleLineComment)
                     || (t.mEnumTokenType == TokenType::MultiLineComment);